@@ -17,7 +17,8 @@
 #include <stdbool.h>
 #include <string.h>
 
-#define TAILLE 12
+#include "sokoban.h"
+#include "moteur.h"
 
 /* Définition des touches */
 
@@ -28,40 +29,19 @@
 #define GIVE_UP     'x'
 #define RESTART     'r'
 
-/* Définition des caractères */
-
-const char PLAYER           = '@';
-const char MUR              = '#';
-const char CAISSE           = '$';
-const char CIBLE            = '.';
-const char PLAYER_SUR_CIBLE = '+';
-const char CAISSE_SUR_CIBLE = '*';
-const char VIDE             = ' ';
-
-/* Définition du tableau */
-
-typedef char t_plateau[TAILLE][TAILLE];
-
 /* Fonctions */
 
-void charger_partie(t_plateau plateau, char fichier[]);
-void enregistrer_partie(t_plateau plateau, char fichier[]);
 int kbhit();
 void afficher_entete(char filename[], int deplacements);
 void afficher_plateau(t_plateau plateau);
-void demarrer_partie(t_plateau plateau, char nomDuFichier[30]);
-void position_joueur(t_plateau plateau, int *posX, int *posY);
-bool gagne(t_plateau plateau);
-void deplacer(t_plateau plateau, int posX, int posY, int *deplacements);
+void demarrer_partie(t_moteur *moteur, char nomDuFichier[30]);
 void afficher_ligne(int longueur);
 int afficher_encadre(char texte[]);
 void gerer_sauvegarde(t_plateau plateau);
-void gestion_deplacement_caisse(t_plateau plateau, char *positionSuivante,
-    char *positionApresSuivante, int *deplacements, int playerX, int playerY);
-void gerer_redemarrage(t_plateau plateau, char nomDuFichier[30],
-    int *deplacements, int *tentatives);
-void gerer_touches(t_plateau plateau, char touche,
-    int *deplacements, int *tentatives, char nomDuFichier[30], bool *isFinished);
+void gerer_redemarrage(t_moteur *moteur, char nomDuFichier[30],
+    int *tentatives);
+void gerer_touches(t_moteur *moteur, char touche,
+    int *tentatives, char nomDuFichier[30], bool *isFinished);
 
 
 /**
@@ -73,28 +53,27 @@ int main()
 {
     /* Variables */
     char touche = '\0', nomDuFichier[30];
-    t_plateau plateau;
-    int deplacements = 0;
+    t_moteur moteur;
     int tentatives = 1;
     bool isFinished = false;
 
-    demarrer_partie(plateau, nomDuFichier);
+    demarrer_partie(&moteur, nomDuFichier);
 
     while(!isFinished)
     {
         if (kbhit()){
             touche = getchar();
 
-            gerer_touches(plateau, touche, &deplacements, &tentatives, nomDuFichier, &isFinished);
+            gerer_touches(&moteur, touche, &tentatives, nomDuFichier, &isFinished);
 
             if(!isFinished){
-                afficher_entete(nomDuFichier, deplacements);
-                afficher_plateau(plateau);
+                afficher_entete(nomDuFichier, moteur.deplacements.nbDeplacements);
+                afficher_plateau(moteur.plateau);
             }
 
-            if(gagne(plateau)){
+            if(gagne(&moteur)){
                 afficher_encadre("Vous avez gagner !");
-                printf("Il vous a fallu %d déplacements et %d tentative(s) pour finir ce niveau.\n", deplacements, tentatives);
+                printf("Il vous a fallu %d déplacements et %d tentative(s) pour finir ce niveau.\n", moteur.deplacements.nbDeplacements, tentatives);
                 isFinished = true;
             }
         }
@@ -107,39 +86,6 @@ int main()
 
 /* Fonctions fournies */
 
-void charger_partie(t_plateau plateau, char fichier[]){
-    FILE * f;
-    char finDeLigne;
-
-    f = fopen(fichier, "r");
-    if (f==NULL){
-        printf("ERREUR SUR FICHIER");
-        exit(EXIT_FAILURE);
-    } else {
-        for (int ligne = 0 ; ligne < TAILLE ; ligne++){
-            for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-                fread(&plateau[ligne][colonne], sizeof(char), 1, f);
-            }
-            fread(&finDeLigne, sizeof(char), 1, f);
-        }
-        fclose(f);
-    }
-}
-
-void enregistrer_partie(t_plateau plateau, char fichier[]){
-    FILE * f;
-    char finDeLigne = '\n';
-
-    f = fopen(fichier, "w");
-    for (int ligne=0 ; ligne<TAILLE ; ligne++){
-        for (int colonne=0 ; colonne<TAILLE ; colonne++){
-            fwrite(&plateau[ligne][colonne], sizeof(char), 1, f);
-        }
-        fwrite(&finDeLigne, sizeof(char), 1, f);
-    }
-    fclose(f);
-}
-
 int kbhit(){
 	// la fonction retourne :
 	// 1 si un caractere est present
@@ -229,12 +175,12 @@ void afficher_plateau(t_plateau plateau)
 /**
 *
 * @brief Démarrage d'une partie
-* @param plateau de type t_plateau, Entrée : tableau du plateau.
+* @param moteur de type t_moteur, Sortie : état de la partie.
 * @param nomDuFichier de type chaîne de caractères Entrée/Sortie
 *   nom du fichier niveau.
 *
 */
-void demarrer_partie(t_plateau plateau, char nomDuFichier[30])
+void demarrer_partie(t_moteur *moteur, char nomDuFichier[30])
 {
     afficher_encadre("SOKOBAN v1");
 
@@ -242,152 +188,9 @@ void demarrer_partie(t_plateau plateau, char nomDuFichier[30])
     scanf("%s", nomDuFichier);
     
     afficher_entete(nomDuFichier, 0);
-    charger_partie(plateau, nomDuFichier);
-
-    afficher_plateau(plateau);
-}
-
-/**
-*
-* @brief Récupérer la position x et y du joueur
-* @param plateau de type t_plateau, Entrée : tableau du plateau.
-* @param posX de type entier, Sortie : position X du joueur.
-* @param posY de type entier, Sortie : position Y du joueur.
-*
-*/
-void position_joueur(t_plateau plateau, int *posX, int *posY)
-{
-    for (int ligne = 0 ; ligne < TAILLE ; ligne++){
-        for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-            if(plateau[ligne][colonne] == PLAYER ||
-                plateau[ligne][colonne] == PLAYER_SUR_CIBLE){
-                (*posX) = ligne;
-                (*posY) = colonne;
-                // quitter pour ne pas continuer le reste du tableau
-                return;
-            }
-        }
-    }
-}
+    charger_niveau(moteur, nomDuFichier);
 
-/**
-*
-* @brief Savoir si la partie est gagnée
-* @param plateau de type t_plateau, Entrée : tableau du plateau.
-* @return vrai si la partie est gagnée sinon faux
-*/
-bool gagne(t_plateau plateau)
-{
-    bool aGagner = true;
-
-    for (int ligne = 0 ; ligne < TAILLE ; ligne++){
-        for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-            // Si y a encore une cible ou qu'un joueur est sur une cible pas encore gagné
-            if(
-                plateau[ligne][colonne] == CIBLE || plateau[ligne][colonne] == PLAYER_SUR_CIBLE
-            ){
-                aGagner = false;
-            }
-        }
-    }
-
-    return aGagner;
-}
-
-/**
-*
-* @brief Gérer le déplacement d'une caissez
-* @param positionSuivante de type t_plateau, Entrée : position après le joueur
-* @param positionApresSuivante de type entier, Entrée : position encore après
-* @param deplacements de type entier, Entrée/Sortie : nombre de déplacements.
-*/
-void gestion_deplacement_caisse(t_plateau plateau, char *positionSuivante,
-    char *positionApresSuivante, int *deplacements, int playerX, int playerY){
-
-    // Déplacer la caisse et si c'est une cible on met une caisse sur une cible
-    if(*positionApresSuivante == CIBLE){
-        *positionApresSuivante = CAISSE_SUR_CIBLE;
-    }
-    else{
-        *positionApresSuivante = CAISSE;
-    }
-            
-    // Déplacer le joueur et si c'est une cible ou une caisse sur une cible,
-    //on met le joueur sur une cible sinon on met juste un joueur
-    if(*positionSuivante == CIBLE || *positionSuivante == CAISSE_SUR_CIBLE){
-        *positionSuivante = PLAYER_SUR_CIBLE;
-    }
-    else{
-        *positionSuivante = PLAYER;
-    }
-
-    // Si le joueur est sur une cible on la remet
-    if(plateau[playerX][playerY] == PLAYER_SUR_CIBLE){
-        plateau[playerX][playerY] = CIBLE;
-    }
-    else
-    {
-        plateau[playerX][playerY] = VIDE;
-    }
-
-    (*deplacements) += 1;
-}
-
-/**
-*
-* @brief Faire se déplacer le joueur
-* @param plateau de type t_plateau, Entrée : tableau du plateau.
-* @param posX de type entier, Entrée : position X du joueur.
-* @param posY de type entier, Entrée : position Y du joueur.
-* @param deplacements de type entier, Entrée/Sortie : nombre de déplacements.
-*/
-void deplacer(t_plateau plateau, int posX, int posY, int *deplacements)
-{
-    int playerX, playerY;
-    position_joueur(plateau, &playerX, &playerY);
-    char *positionSuivante = &plateau[playerX+posX][playerY+posY];
-    char *positionApresSuivante = &plateau[playerX+posX+posX][playerY+posY+posY];
-
-    // Si on est pas contre un bord et qu'on ne sort pas du plateau
-    if(*positionSuivante != MUR && playerX+posX < TAILLE && playerY+posY < TAILLE
-        && playerX+posX >= 0 && playerY+posY >= 0)
-    {
-        // Si on ne pousse pas de caisse
-        if(*positionSuivante != CAISSE && *positionSuivante != CAISSE_SUR_CIBLE)
-        {
-
-            // Si la position suivante est une cible
-            //on ajoute un joueur sur la cible sinon on met juste un joueur
-            if(*positionSuivante == CIBLE)
-            {
-                *positionSuivante = PLAYER_SUR_CIBLE;
-            }
-            else{
-                *positionSuivante = PLAYER;
-            }
-            
-            // Si le joueur est sur une cible on la remet sinon on met du vide
-            if(plateau[playerX][playerY] == PLAYER_SUR_CIBLE){
-                plateau[playerX][playerY] = CIBLE;
-            }
-            else
-            {
-                plateau[playerX][playerY] = VIDE;
-            }
-
-            (*deplacements) += 1;
-        }
-        // Sinon on tente de pousser une caisse mais on vérifie que la case derrière
-        // n'est pas un mur ou une autre caisse
-        else if(
-            *positionApresSuivante != MUR &&
-            *positionApresSuivante != CAISSE &&
-            *positionApresSuivante != CAISSE_SUR_CIBLE
-        ){
-            gestion_deplacement_caisse(plateau, positionSuivante,
-                positionApresSuivante, deplacements, playerX, playerY);
-        }
-    }
+    afficher_plateau(moteur->plateau);
 }
 
 /**
@@ -451,12 +254,11 @@ void gerer_sauvegarde(t_plateau plateau){
 /**
 *
 * @brief Demander et gérer le fait de recommencer un niveau
-* @param plateau de type t_plateau, Entrée : plateau de jeu.
-* @param deplacements de type entier, Entrée/Sortie : nombre de déplacements.
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie.
 * @param nomDuFichier de type caractère, Entrée : Fichier de jeu.
 */
-void gerer_redemarrage(t_plateau plateau, char nomDuFichier[30],
-    int *deplacements, int *tentatives){
+void gerer_redemarrage(t_moteur *moteur, char nomDuFichier[30],
+    int *tentatives){
 
     char touche = '\0';
 
@@ -465,8 +267,7 @@ void gerer_redemarrage(t_plateau plateau, char nomDuFichier[30],
 
     if(touche == 'o'){
         // On recharge le fichier 
-        charger_partie(plateau, nomDuFichier);
-        *deplacements = 0;
+        charger_niveau(moteur, nomDuFichier);
         (*tentatives)++;
     }
 }
@@ -474,34 +275,33 @@ void gerer_redemarrage(t_plateau plateau, char nomDuFichier[30],
 /**
 *
 * @brief Redistribuer les actions en fonction des touches pressées
-* @param plateau de type t_plateau, Entrée : plateau de jeu.
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie.
 * @param touche de type caractère, Entrée : touche pressée.
-* @param deplacements de type entier, Entrée/Sortie : nombre de déplacements.
 * @param nomDuFichier de type caractère, Entrée : Fichier de jeu.
 * @param isFinished de type booléen, Entrée : La partie est elle terminée.
 */
-void gerer_touches(t_plateau plateau, char touche, int *deplacements,
+void gerer_touches(t_moteur *moteur, char touche,
      int *tentatives, char nomDuFichier[30], bool *isFinished){
     switch(touche)
     {
         case MOVE_UP:
-            deplacer(plateau, -1, 0, deplacements);
+            deplacer(moteur, -1, 0);
             break;
         case MOVE_LEFT:
-            deplacer(plateau, 0, -1, deplacements);
+            deplacer(moteur, 0, -1);
             break;
         case MOVE_DOWN:
-            deplacer(plateau, 1, 0, deplacements);
+            deplacer(moteur, 1, 0);
             break;
         case MOVE_RIGHT:
-            deplacer(plateau, 0, 1, deplacements);
+            deplacer(moteur, 0, 1);
             break;
         case GIVE_UP:
             *isFinished = true;
-            gerer_sauvegarde(plateau);
+            gerer_sauvegarde(moteur->plateau);
             break;
         case RESTART:
-            gerer_redemarrage(plateau, nomDuFichier, deplacements, tentatives);
+            gerer_redemarrage(moteur, nomDuFichier, tentatives);
             break;
     }
 }
\ No newline at end of file
@@ -0,0 +1,428 @@
+/**
+* @file affichage.c
+* @brief Affichage de la partie dans le terminal : entête, plateau et vue
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Fonctions reprises du jeu (main.c).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+
+#include "sokoban.h"
+#include "touches.h"
+#include "affichage.h"
+
+/* Définition des constantes d'affichage */
+
+const char FIN_COULEUR[TAILLE_COULEUR]  = "\033[0m";
+const char ROUGE[TAILLE_COULEUR]        = "\033[31m";
+const char VERT[TAILLE_COULEUR]         = "\033[32m";
+const char JAUNE[TAILLE_COULEUR]        = "\033[33m";
+const char BLEU[TAILLE_COULEUR]         = "\033[34m";
+
+// Chaque image réécrit l'écran depuis le coin haut gauche : la fin de
+// chaque ligne et le bas de l'écran sont effacés au lieu de tout l'écran
+const char DEBUT_ECRAN[TAILLE_COULEUR]  = "\033[H";
+const char FIN_LIGNE[TAILLE_COULEUR]    = "\033[K\n";
+const char FIN_ECRAN[TAILLE_COULEUR]    = "\033[J";
+
+// Directions du solveur : haut, bas, gauche, droite
+const char NOMS_DIRECTIONS[4][12] = {
+    "le haut", "le bas", "la gauche", "la droite"
+};
+
+/* Fonctions internes */
+
+void afficher_entete(t_partie jeu);
+const char *couleur_case(char contenu, char *glyphe);
+void ajouter_texte(char tampon[], int *longueur, const char texte[]);
+int rendre_ligne(t_partie *jeu, int ligne, char tampon[]);
+void afficher_ligne(int longueur);
+int recuperer_lignes_utiles(t_partie jeu);
+int debut_vue(int debut, int taille, int total, int position);
+
+/**
+*
+* @brief Affichage de l'entête
+* @param jeu de type t_partie, Entrée : structure de la partie.
+*
+*/
+void afficher_entete(t_partie jeu)
+{
+    int longueurTexte;
+
+    fputs(DEBUT_ECRAN, stdout);
+    longueurTexte = afficher_encadre("SOKOBAN v2 - Liam CHARPENTIER");
+
+    printf("Fichier chargé : %s%s", jeu.nomFichier, FIN_LIGNE);
+    afficher_ligne(longueurTexte);
+
+    printf("Haut : %c | Bas : %c%sGauche : %c | Droite : %c%s",
+        MOVE_UP, MOVE_DOWN, FIN_LIGNE, MOVE_LEFT, MOVE_RIGHT, FIN_LIGNE
+    );
+    printf("Zoomer : %c | Dézoomer : %c | Pousser jusqu'au bout : %c%s",
+        ZOOM_IN, ZOOM_OUT, PUSH_THROUGH, FIN_LIGNE
+    );
+    printf("Abandonner : %c | Recommencer : %c | Action précédente : %c"
+        " | Conseil : %c%s", GIVE_UP, RESTART, UNDO, HINT, FIN_LIGNE
+    );
+    afficher_ligne(longueurTexte);
+
+    printf("Déplacements : %d", jeu.moteur.deplacements.nbDeplacements);
+    if(jeu.coupBloquant >= 0){
+        printf(" | %sCaisse bloquée !%s (annuler : %c)", ROUGE, FIN_COULEUR,
+            UNDO);
+    }
+    if(jeu.coupConseil == jeu.moteur.deplacements.nbDeplacements){
+        printf(" | Conseil : ");
+        if(jeu.pousseeConseillee.caisse < 0){
+            printf("aucune poussée trouvée");
+        }
+        else{
+            printf("%scaisse%s vers %s", BLEU, FIN_COULEUR,
+                NOMS_DIRECTIONS[jeu.pousseeConseillee.direction]);
+        }
+    }
+    // La ligne suivante (vide sinon) indique si le niveau peut encore
+    // être gagné
+    fputs(FIN_LIGNE, stdout);
+    if(jeu.surveillance != NULL){
+        printf("Résoluble : ");
+        if(jeu.verificationEnCours){
+            printf("%s...%s", JAUNE, FIN_COULEUR);
+        }
+        else if(jeu.resolubilite == VERDICT_RESOLU){
+            printf("%soui%s", VERT, FIN_COULEUR);
+        }
+        else if(jeu.resolubilite == VERDICT_IMPOSSIBLE){
+            printf("%snon%s", ROUGE, FIN_COULEUR);
+        }
+        else{
+            printf("?");
+        }
+    }
+    fputs(FIN_LIGNE, stdout);
+    afficher_ligne(longueurTexte);
+}
+
+/**
+*
+* @brief Récupérer la couleur et le caractère affiché d'une case
+* @param contenu de type caractère, Entrée : contenu de la case
+* @param glyphe de type caractère, Sortie : caractère à afficher
+* @return couleur de la case, NULL si elle n'est pas colorée
+* Les joueurs sur une cible sont seulement représentés pas un joueur
+* Les caisses sur une cible sont seulement représentés par une caisse
+* Eléments importants en couleur
+*
+*/
+const char *couleur_case(char contenu, char *glyphe)
+{
+    const char *couleur = NULL;
+
+    *glyphe = contenu;
+
+    if(contenu == PLAYER){
+        couleur = JAUNE;
+    }
+    else if(contenu == PLAYER_SUR_CIBLE){
+        couleur = ROUGE;
+        *glyphe = PLAYER;
+    }
+    else if (contenu == CAISSE_SUR_CIBLE){
+        couleur = VERT;
+        *glyphe = CAISSE;
+    }
+    else if (contenu == CIBLE){
+        couleur = ROUGE;
+    }
+
+    return couleur;
+}
+
+/**
+*
+* @brief Ajouter un texte à la fin d'un tampon d'affichage
+* @param tampon de type chaîne de caractères, Entrée/Sortie : tampon
+* @param longueur de type entier, Entrée/Sortie : longueur du tampon
+* @param texte de type chaîne de caractères, Entrée : texte à ajouter
+*
+*/
+void ajouter_texte(char tampon[], int *longueur, const char texte[])
+{
+    int longueurTexte = strlen(texte);
+
+    memcpy(&tampon[*longueur], texte, longueurTexte);
+    *longueur += longueurTexte;
+}
+
+/**
+*
+* @brief Écrire une ligne du plateau, élargie selon le zoom, dans un tampon
+* @param jeu de type t_partie, Entrée : structure de la partie
+* @param ligne de type entier, Entrée : indice de la ligne
+* @param tampon de type chaîne de caractères, Sortie : octets de la ligne
+* @return entier : nombre d'octets écrits (fin de ligne comprise)
+* Les codes couleur ne sont écrits que quand la couleur change, et la
+* couleur est toujours remise à zéro en fin de ligne
+*
+*/
+int rendre_ligne(t_partie *jeu, int ligne, char tampon[])
+{
+    const char *couleurCourante = NULL;
+    const char *couleur;
+    char glyphe;
+    int longueur = 0;
+
+    for (int colonne = jeu->vue.premiereColonne ;
+        colonne < jeu->vue.premiereColonne + jeu->vue.nbColonnes ;
+        colonne++){
+        couleur = couleur_case(jeu->moteur.plateau[ligne][colonne], &glyphe);
+        // Caisse à pousser d'après le dernier conseil
+        if(jeu->coupConseil == jeu->moteur.deplacements.nbDeplacements &&
+            jeu->pousseeConseillee.caisse == ligne * TAILLE + colonne){
+            couleur = BLEU;
+        }
+
+        if(couleur != couleurCourante){
+            ajouter_texte(tampon, &longueur,
+                couleur != NULL ? couleur : FIN_COULEUR);
+            couleurCourante = couleur;
+        }
+
+        memset(&tampon[longueur], glyphe, jeu->zoom);
+        longueur += jeu->zoom;
+    }
+
+    if(couleurCourante != NULL){
+        ajouter_texte(tampon, &longueur, FIN_COULEUR);
+    }
+    ajouter_texte(tampon, &longueur, FIN_LIGNE);
+
+    return longueur;
+}
+
+/**
+*
+* @brief Affichage du plateau
+* @param plateau de type t_partie, Entrée : structure de la partie
+* Seules les cases de la vue sont affichées (voir mettre_a_jour_vue)
+* Chaque ligne est mise en forme une seule fois puis écrite zoom fois
+*
+*/
+void afficher_plateau(t_partie jeu)
+{
+    char tampon[TAILLE_LIGNE_RENDU];
+    int longueur;
+
+    for (int ligne = jeu.vue.premiereLigne ;
+        ligne < jeu.vue.premiereLigne + jeu.vue.nbLignes ; ligne++){
+        longueur = rendre_ligne(&jeu, ligne, tampon);
+
+        for(int i = 0 ; i < jeu.zoom ; i++){
+            fwrite(tampon, sizeof(char), longueur, stdout);
+        }
+    }
+}
+
+/**
+*
+* @brief Afficher une ligne de longeur X du caractère *
+* @param longueur de type entier, Entrée : longueur de la ligne.
+*/
+void afficher_ligne(int longueur){
+    for (int i = 0 ; i < longueur ; i++)
+    {
+        printf("*");
+    }
+
+    fputs(FIN_LIGNE, stdout);
+}
+
+/**
+*
+* @brief Afficher un encadré autour du texte
+* @param texte de type chaîne de caractères, Entrée : texte à afficher.
+* @return longeur du texte
+*/
+int afficher_encadre(char texte[]){
+
+    // taille du texte
+    int longueur = strlen(texte);
+    int largeur = longueur + 4;
+
+    afficher_ligne(largeur);
+    printf("* %s *%s", texte, FIN_LIGNE);
+    afficher_ligne(largeur);
+    fputs(FIN_LIGNE, stdout);
+
+    return largeur;
+}
+
+/**
+*
+* @brief Récupérer le nombre de lignes vraiment utiles à l'affichage
+*  du plateau
+* @return entier : nombre de lignes utiles
+*/
+int recuperer_lignes_utiles(t_partie jeu){
+    int lignesAAfficher = TAILLE;
+    int ligne = TAILLE - 1;
+    int colonne = 0;
+    bool finAtteinte = false;
+    bool ligneVide;
+
+    while(!finAtteinte && ligne >= 0){
+        ligneVide = true;
+        while(!finAtteinte && colonne < TAILLE){
+            if(jeu.moteur.plateau[ligne][colonne] != VIDE){
+                finAtteinte = true;
+                ligneVide = false;
+            }
+            colonne++;
+        }
+
+        if(ligneVide){
+            lignesAAfficher--;
+        }
+
+        colonne = 0;
+        ligne--;
+    }
+
+    return lignesAAfficher;
+}
+
+/**
+*
+* @brief Lire la taille du terminal (variables LINES et COLUMNS, sinon
+*   80x24, si la sortie n'est pas un terminal)
+* @param vue de type t_vue, Entrée/Sortie : vue à mettre à jour
+*
+*/
+void lire_taille_terminal(t_vue *vue){
+    struct winsize taille;
+    char *lignes = getenv("LINES");
+    char *colonnes = getenv("COLUMNS");
+
+    vue->lignesTerminal = lignes != NULL ? atoi(lignes) : LIGNES_TERMINAL;
+    vue->colonnesTerminal =
+        colonnes != NULL ? atoi(colonnes) : COLONNES_TERMINAL;
+
+    if(ioctl(STDOUT_FILENO, TIOCGWINSZ, &taille) == 0 &&
+        taille.ws_row > 0 && taille.ws_col > 0){
+        vue->lignesTerminal = taille.ws_row;
+        vue->colonnesTerminal = taille.ws_col;
+    }
+}
+
+/**
+*
+* @brief Calculer le début de la vue sur un axe
+* @param debut de type entier, Entrée : début actuel de la vue
+* @param taille de type entier, Entrée : nombre de cases visibles
+* @param total de type entier, Entrée : nombre de cases du plateau
+* @param position de type entier, Entrée : position du joueur
+* @return entier : nouveau début de la vue
+* La vue ne bouge que si le joueur sort de la marge, elle est alors
+* recentrée sur lui
+*/
+int debut_vue(int debut, int taille, int total, int position){
+    int marge = MARGE_VUE;
+
+    if(marge > (taille - 1) / 2){
+        marge = (taille - 1) / 2;
+    }
+
+    if(position < debut + marge || position > debut + taille - 1 - marge){
+        debut = position - taille / 2;
+    }
+
+    if(debut > total - taille){
+        debut = total - taille;
+    }
+    if(debut < 0){
+        debut = 0;
+    }
+
+    return debut;
+}
+
+/**
+*
+* @brief Mettre à jour la partie du plateau visible dans le terminal
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*
+*/
+void mettre_a_jour_vue(t_partie *jeu){
+    int lignesUtiles = recuperer_lignes_utiles(*jeu);
+    int nbLignes = (jeu->vue.lignesTerminal - HAUTEUR_ENTETE) / jeu->zoom;
+    int nbColonnes = jeu->vue.colonnesTerminal / jeu->zoom;
+
+    if(nbLignes > lignesUtiles){
+        nbLignes = lignesUtiles;
+    }
+    if(nbLignes < 1){
+        nbLignes = 1;
+    }
+    if(nbColonnes > TAILLE){
+        nbColonnes = TAILLE;
+    }
+    if(nbColonnes < 1){
+        nbColonnes = 1;
+    }
+
+    jeu->vue.premiereLigne = debut_vue(jeu->vue.premiereLigne, nbLignes,
+        lignesUtiles, jeu->moteur.joueur.posX);
+    jeu->vue.premiereColonne = debut_vue(jeu->vue.premiereColonne,
+        nbColonnes, TAILLE, jeu->moteur.joueur.posY);
+    jeu->vue.nbLignes = nbLignes;
+    jeu->vue.nbColonnes = nbColonnes;
+}
+
+/**
+*
+* @brief Mettre à jour la vue puis afficher l'entête et le plateau
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*
+*/
+void rafraichir_affichage(t_partie *jeu){
+    long debut = debut_trace(&jeu->trace);
+    long debutEtape;
+
+    mettre_a_jour_vue(jeu);
+    debutEtape = debut_trace(&jeu->trace);
+    afficher_entete(*jeu);
+    noter_trace(&jeu->trace, "entete", debutEtape, '\0');
+    debutEtape = debut_trace(&jeu->trace);
+    afficher_plateau(*jeu);
+    fputs(FIN_ECRAN, stdout);
+    // La sortie est mise en tampon : fflush en fait partie du rendu
+    fflush(stdout);
+    noter_trace(&jeu->trace, "plateau", debutEtape, '\0');
+    noter_trace(&jeu->trace, "rendu", debut, '\0');
+    jeu->imageEnRetard = false;
+    jeu->derniereImage = lire_horloge();
+}
+
+/**
+*
+* @brief Lire l'horloge monotone
+* @return entier long : temps en nanosecondes
+*
+*/
+long lire_horloge(void){
+    struct timespec temps;
+
+    clock_gettime(CLOCK_MONOTONIC, &temps);
+
+    return temps.tv_sec * 1000000000L + temps.tv_nsec;
+}
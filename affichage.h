@@ -0,0 +1,39 @@
+/**
+* @file affichage.h
+* @brief Affichage de la partie dans le terminal : entête, plateau et vue
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Quand le plateau dépasse du terminal, seule une vue autour du joueur est
+* affichée (voir mettre_a_jour_vue). Chaque ligne du plateau est mise en
+* forme dans un tampon puis écrite d'un coup. Utilisé par le jeu (main.c)
+* et par bin/bench, qui mesure le rendu.
+*/
+
+#ifndef AFFICHAGE_H
+#define AFFICHAGE_H
+
+#include "partie.h"
+
+/* Tampons d'affichage */
+
+#define TAILLE_COULEUR      10   // voir FIN_COULEUR, ROUGE, FIN_LIGNE...
+// Couleur et 3 caractères par case, puis FIN_COULEUR et FIN_LIGNE
+#define TAILLE_LIGNE_RENDU  (TAILLE * (TAILLE_COULEUR + 3) + 2 * TAILLE_COULEUR)
+
+/* Vue (partie du plateau affichée quand il dépasse du terminal) */
+
+#define HAUTEUR_ENTETE      14   // lignes affichées par afficher_entete
+#define MARGE_VUE           2    // cases gardées entre le joueur et le bord
+#define LIGNES_TERMINAL     24   // taille par défaut si elle est inconnue
+#define COLONNES_TERMINAL   80
+
+void afficher_plateau(t_partie jeu);
+int afficher_encadre(char texte[]);
+void lire_taille_terminal(t_vue *vue);
+void mettre_a_jour_vue(t_partie *jeu);
+void rafraichir_affichage(t_partie *jeu);
+long lire_horloge(void);
+
+#endif
@@ -0,0 +1,432 @@
+/**
+* @file anim_delta.c
+* @brief Conversion et lecture des animations compactes (.anim)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Les animations de frames/<nom>/f1..fN sont des images ASCII complètes qui
+* ne diffèrent que par de petites zones. Le convertisseur ne garde que la
+* première image et les zones modifiées des suivantes, et le lecteur
+* n'envoie au terminal que ces zones (positionnement du curseur + texte).
+*/
+
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "anim_delta.h"
+
+const char ANIM_SIGNATURE[5] = "SKAN";
+
+/* Fonctions internes */
+
+bool lire_image(char chemin[], t_image image, int *largeur, int *hauteur);
+int fin_zone(char avant[], char apres[], int largeur, int debut);
+int calculer_zones(t_image avant, t_image apres, int largeur, int hauteur,
+    t_zone zones[]);
+void ecrire_entier(FILE *f, int valeur);
+int lire_entier(unsigned char donnees[], long taille, long *position);
+void ecrire_differences(FILE *f, t_image avant, t_image apres,
+    int largeur, int hauteur);
+unsigned char *charger_fichier_anim(char fichier[], long *taille);
+void afficher_zones(t_image image, t_zone zones[], int nbZones);
+bool appliquer_differences(unsigned char donnees[], long taille,
+    long *position, t_image image, int largeur, int hauteur);
+void revenir_image_cle(t_image affichee, t_image cle, int largeur,
+    int hauteur);
+
+/**
+*
+* @brief Lire une image ASCII (une ligne du fichier = une ligne de l'image)
+* @param chemin de type chaîne de caractères, Entrée : fichier de l'image
+* @param image de type t_image, Sortie : image complétée par des espaces
+* @param largeur de type entier, Entrée/Sortie : plus grande largeur lue
+* @param hauteur de type entier, Entrée/Sortie : plus grande hauteur lue
+* @return vrai si le fichier existe
+*/
+bool lire_image(char chemin[], t_image image, int *largeur, int *hauteur)
+{
+    FILE *f;
+    char *ligneLue = NULL;
+    size_t taille = 0;
+    ssize_t longueur;
+    int ligne = 0;
+
+    f = fopen(chemin, "r");
+    if(f == NULL){
+        return false;
+    }
+
+    memset(image, ' ', sizeof(t_image));
+
+    while((longueur = getline(&ligneLue, &taille, f)) != -1 &&
+        ligne < ANIM_HAUTEUR_MAX){
+        if(longueur > 0 && ligneLue[longueur-1] == '\n'){
+            longueur--;
+        }
+        if(longueur > ANIM_LARGEUR_MAX){
+            longueur = ANIM_LARGEUR_MAX;
+        }
+        memcpy(image[ligne], ligneLue, longueur);
+
+        if(longueur > *largeur){
+            *largeur = longueur;
+        }
+        ligne++;
+    }
+
+    if(ligne > *hauteur){
+        *hauteur = ligne;
+    }
+
+    free(ligneLue);
+    fclose(f);
+
+    return true;
+}
+
+/**
+*
+* @brief Trouver la dernière colonne d'une zone modifiée commençant en debut
+*   (les zones proches sont fusionnées, voir ANIM_ECART_FUSION)
+* @param avant de type chaîne de caractères, Entrée : ligne affichée
+* @param apres de type chaîne de caractères, Entrée : ligne à afficher
+* @param largeur de type entier, Entrée : largeur de la ligne
+* @param debut de type entier, Entrée : première colonne modifiée
+* @return entier : dernière colonne modifiée de la zone
+*/
+int fin_zone(char avant[], char apres[], int largeur, int debut)
+{
+    int fin = debut;
+    int colonne = debut + 1;
+
+    while(colonne < largeur && colonne - fin <= ANIM_ECART_FUSION){
+        if(avant[colonne] != apres[colonne]){
+            fin = colonne;
+        }
+        colonne++;
+    }
+
+    return fin;
+}
+
+/**
+*
+* @brief Calculer les zones qui diffèrent entre deux images
+* @param avant de type t_image, Entrée : image affichée
+* @param apres de type t_image, Entrée : image à afficher
+* @param largeur de type entier, Entrée : largeur des images
+* @param hauteur de type entier, Entrée : hauteur des images
+* @param zones de type t_zone[], Sortie : zones modifiées
+* @return entier : nombre de zones
+*/
+int calculer_zones(t_image avant, t_image apres, int largeur, int hauteur,
+    t_zone zones[])
+{
+    int nbZones = 0;
+    int colonne;
+    int fin;
+
+    for(int ligne = 0 ; ligne < hauteur ; ligne++){
+        colonne = 0;
+        while(colonne < largeur){
+            if(avant[ligne][colonne] != apres[ligne][colonne]){
+                fin = fin_zone(avant[ligne], apres[ligne], largeur, colonne);
+
+                zones[nbZones].ligne = ligne;
+                zones[nbZones].colonne = colonne;
+                zones[nbZones].longueur = fin - colonne + 1;
+                nbZones++;
+
+                colonne = fin;
+            }
+            colonne++;
+        }
+    }
+
+    return nbZones;
+}
+
+/**
+*
+* @brief Écrire un entier sur 2 octets
+* @param f de type FILE*, Entrée : fichier ouvert en écriture
+* @param valeur de type entier, Entrée : valeur (0 à 65535)
+*/
+void ecrire_entier(FILE *f, int valeur)
+{
+    fputc(valeur & 0xFF, f);
+    fputc((valeur >> 8) & 0xFF, f);
+}
+
+/**
+*
+* @brief Lire un entier sur 2 octets
+* @param donnees de type octets, Entrée : contenu du fichier
+* @param taille de type entier long, Entrée : taille du contenu
+* @param position de type entier long, Entrée/Sortie : position de lecture
+* @return entier : valeur lue, -1 si on dépasse la fin du contenu
+*/
+int lire_entier(unsigned char donnees[], long taille, long *position)
+{
+    int valeur = -1;
+
+    if(*position + 2 <= taille){
+        valeur = donnees[*position] | (donnees[*position+1] << 8);
+        *position += 2;
+    }
+
+    return valeur;
+}
+
+/**
+*
+* @brief Écrire les zones qui diffèrent entre deux images
+* @param f de type FILE*, Entrée : fichier ouvert en écriture
+* @param avant de type t_image, Entrée : image précédente
+* @param apres de type t_image, Entrée : image suivante
+* @param largeur de type entier, Entrée : largeur des images
+* @param hauteur de type entier, Entrée : hauteur des images
+*/
+void ecrire_differences(FILE *f, t_image avant, t_image apres,
+    int largeur, int hauteur)
+{
+    t_zone *zones = malloc(sizeof(t_zone) * ANIM_HAUTEUR_MAX *
+        ANIM_LARGEUR_MAX);
+    int nbZones = calculer_zones(avant, apres, largeur, hauteur, zones);
+
+    ecrire_entier(f, nbZones);
+    for(int i = 0 ; i < nbZones ; i++){
+        ecrire_entier(f, zones[i].ligne);
+        ecrire_entier(f, zones[i].colonne);
+        ecrire_entier(f, zones[i].longueur);
+        fwrite(&apres[zones[i].ligne][zones[i].colonne], sizeof(char),
+            zones[i].longueur, f);
+    }
+
+    free(zones);
+}
+
+/**
+*
+* @brief Convertir un dossier d'images f1..fN en fichier .anim
+* @param dossier de type chaîne de caractères, Entrée : dossier des images
+* @param fichierSortie de type chaîne de caractères, Entrée : fichier .anim
+* @return vrai si la conversion a réussi
+*/
+bool convertir_dossier_anim(char dossier[], char fichierSortie[])
+{
+    FILE *f;
+    char chemin[300];
+    int nbImages = 0;
+    int largeur = 0;
+    int hauteur = 0;
+    bool imageLue = true;
+    t_image *images = malloc(sizeof(t_image) * ANIM_IMAGES_MAX);
+
+    while(imageLue && nbImages < ANIM_IMAGES_MAX){
+        snprintf(chemin, sizeof(chemin), "%s/f%d", dossier, nbImages + 1);
+        imageLue = lire_image(chemin, images[nbImages], &largeur, &hauteur);
+        if(imageLue){
+            nbImages++;
+        }
+    }
+
+    f = (nbImages > 0) ? fopen(fichierSortie, "wb") : NULL;
+    if(f == NULL){
+        free(images);
+        return false;
+    }
+
+    fwrite(ANIM_SIGNATURE, sizeof(char), 4, f);
+    fputc(ANIM_VERSION, f);
+    ecrire_entier(f, largeur);
+    ecrire_entier(f, hauteur);
+    ecrire_entier(f, nbImages);
+
+    for(int ligne = 0 ; ligne < hauteur ; ligne++){
+        fwrite(images[0][ligne], sizeof(char), largeur, f);
+    }
+    for(int i = 1 ; i < nbImages ; i++){
+        ecrire_differences(f, images[i-1], images[i], largeur, hauteur);
+    }
+
+    fclose(f);
+    free(images);
+
+    return true;
+}
+
+/**
+*
+* @brief Charger tout le contenu d'un fichier en mémoire
+* @param fichier de type chaîne de caractères, Entrée : fichier à lire
+* @param taille de type entier long, Sortie : taille du contenu
+* @return contenu du fichier (à libérer), NULL en cas d'erreur
+*/
+unsigned char *charger_fichier_anim(char fichier[], long *taille)
+{
+    FILE *f;
+    unsigned char *donnees = NULL;
+
+    f = fopen(fichier, "rb");
+    if(f != NULL){
+        fseek(f, 0, SEEK_END);
+        *taille = ftell(f);
+        fseek(f, 0, SEEK_SET);
+
+        donnees = malloc(*taille > 0 ? *taille : 1);
+        if(fread(donnees, sizeof(char), *taille, f) != (size_t)*taille){
+            free(donnees);
+            donnees = NULL;
+        }
+        fclose(f);
+    }
+
+    return donnees;
+}
+
+/**
+*
+* @brief Envoyer au terminal les zones d'une image
+* @param image de type t_image, Entrée : image à afficher
+* @param zones de type t_zone[], Entrée : zones à afficher
+* @param nbZones de type entier, Entrée : nombre de zones
+*/
+void afficher_zones(t_image image, t_zone zones[], int nbZones)
+{
+    for(int i = 0 ; i < nbZones ; i++){
+        printf("\033[%d;%dH", zones[i].ligne + 1, zones[i].colonne + 1);
+        fwrite(&image[zones[i].ligne][zones[i].colonne], sizeof(char),
+            zones[i].longueur, stdout);
+    }
+}
+
+/**
+*
+* @brief Lire les différences d'une image, les appliquer et les afficher
+* @param donnees de type octets, Entrée : contenu du fichier .anim
+* @param taille de type entier long, Entrée : taille du contenu
+* @param position de type entier long, Entrée/Sortie : position de lecture
+* @param image de type t_image, Entrée/Sortie : image affichée
+* @param largeur de type entier, Entrée : largeur de l'image
+* @param hauteur de type entier, Entrée : hauteur de l'image
+* @return vrai si les différences sont valides
+*/
+bool appliquer_differences(unsigned char donnees[], long taille,
+    long *position, t_image image, int largeur, int hauteur)
+{
+    t_zone zone;
+    bool valide = true;
+    int nbZones = lire_entier(donnees, taille, position);
+
+    for(int i = 0 ; valide && i < nbZones ; i++){
+        zone.ligne = lire_entier(donnees, taille, position);
+        zone.colonne = lire_entier(donnees, taille, position);
+        zone.longueur = lire_entier(donnees, taille, position);
+
+        valide = zone.longueur >= 0 && zone.ligne >= 0 &&
+            zone.ligne < hauteur && zone.colonne >= 0 &&
+            zone.colonne + zone.longueur <= largeur &&
+            *position + zone.longueur <= taille;
+
+        if(valide){
+            memcpy(&image[zone.ligne][zone.colonne], &donnees[*position],
+                zone.longueur);
+            *position += zone.longueur;
+            afficher_zones(image, &zone, 1);
+        }
+    }
+
+    return valide && nbZones >= 0;
+}
+
+/**
+*
+* @brief Revenir à l'image clé pour reboucler l'animation
+* @param affichee de type t_image, Entrée/Sortie : image affichée
+* @param cle de type t_image, Entrée : image clé
+* @param largeur de type entier, Entrée : largeur de l'image
+* @param hauteur de type entier, Entrée : hauteur de l'image
+*/
+void revenir_image_cle(t_image affichee, t_image cle, int largeur,
+    int hauteur)
+{
+    t_zone *zones = malloc(sizeof(t_zone) * ANIM_HAUTEUR_MAX *
+        ANIM_LARGEUR_MAX);
+    int nbZones = calculer_zones(affichee, cle, largeur, hauteur, zones);
+
+    afficher_zones(cle, zones, nbZones);
+    memcpy(affichee, cle, sizeof(t_image));
+
+    free(zones);
+}
+
+/**
+*
+* @brief Jouer une animation .anim en n'affichant que les zones modifiées
+* @param fichier de type chaîne de caractères, Entrée : fichier .anim
+* @param nbBoucles de type entier, Entrée : nombre de lectures
+* @param delaiMs de type entier, Entrée : délai entre deux images (ms)
+* @return vrai si l'animation a pu être jouée
+*/
+bool jouer_anim(char fichier[], int nbBoucles, int delaiMs)
+{
+    long taille = 0;
+    long position = 5;
+    long debutDifferences;
+    int largeur, hauteur, nbImages;
+    bool valide;
+    unsigned char *donnees = charger_fichier_anim(fichier, &taille);
+    t_image *images = malloc(sizeof(t_image) * 2);
+
+    valide = donnees != NULL && taille > 5 &&
+        memcmp(donnees, ANIM_SIGNATURE, 4) == 0 &&
+        donnees[4] == ANIM_VERSION;
+    largeur = valide ? lire_entier(donnees, taille, &position) : -1;
+    hauteur = valide ? lire_entier(donnees, taille, &position) : -1;
+    nbImages = valide ? lire_entier(donnees, taille, &position) : -1;
+    debutDifferences = position + (long)largeur * hauteur;
+
+    valide = nbImages > 0 && largeur <= ANIM_LARGEUR_MAX &&
+        hauteur <= ANIM_HAUTEUR_MAX && debutDifferences <= taille;
+
+    if(valide){
+        memset(images[0], ' ', sizeof(t_image));
+        for(int ligne = 0 ; ligne < hauteur ; ligne++){
+            memcpy(images[0][ligne], &donnees[position + ligne * largeur],
+                largeur);
+            printf("%s%.*s\n", ligne == 0 ? "\033[2J\033[H" : "",
+                largeur, images[0][ligne]);
+        }
+        memcpy(images[1], images[0], sizeof(t_image));
+        fflush(stdout);
+    }
+
+    for(int boucle = 0 ; valide && boucle < nbBoucles ; boucle++){
+        position = debutDifferences;
+        for(int i = 1 ; valide && i <= nbImages ; i++){
+            usleep(delaiMs * 1000);
+            if(i < nbImages){
+                valide = appliquer_differences(donnees, taille, &position,
+                    images[1], largeur, hauteur);
+            }
+            else if(boucle + 1 < nbBoucles){
+                revenir_image_cle(images[1], images[0], largeur, hauteur);
+            }
+            fflush(stdout);
+        }
+    }
+
+    if(valide){
+        printf("\033[%d;1H", hauteur + 1);
+    }
+
+    free(donnees);
+    free(images);
+
+    return valide;
+}
@@ -0,0 +1,42 @@
+/**
+* @file anim_delta.h
+* @brief Format d'animation compact (image clé + différences)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Un fichier .anim contient :
+* - un en-tête : "SKAN", version, largeur, hauteur, nombre d'images
+* - la première image complète (image clé) : largeur * hauteur octets
+* - pour chaque image suivante : le nombre de zones modifiées puis chaque
+*   zone (ligne, colonne, longueur, caractères)
+* Les entiers sont stockés sur 2 octets (octet de poids faible en premier).
+*/
+
+#ifndef ANIM_DELTA_H
+#define ANIM_DELTA_H
+
+#include <stdbool.h>
+
+#define ANIM_LARGEUR_MAX    200
+#define ANIM_HAUTEUR_MAX    100
+#define ANIM_IMAGES_MAX     100
+#define ANIM_VERSION        1
+
+// Deux zones séparées par moins de caractères inchangés que ce seuil sont
+// fusionnées : repositionner le curseur coûte à peu près autant
+#define ANIM_ECART_FUSION   8
+
+typedef char t_image[ANIM_HAUTEUR_MAX][ANIM_LARGEUR_MAX];
+
+// Zone modifiée d'une ligne entre deux images
+typedef struct {
+    int ligne;
+    int colonne;
+    int longueur;
+} t_zone;
+
+bool convertir_dossier_anim(char dossier[], char fichierSortie[]);
+bool jouer_anim(char fichier[], int nbBoucles, int delaiMs);
+
+#endif
@@ -0,0 +1,407 @@
+/**
+* @file bidirectionnel.c
+* @brief Recherche bidirectionnelle : poussées depuis le départ et tirages
+*   depuis les positions résolues
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Un noeud arrière garde dans caisse et direction la poussée qui mène de
+* son état à celui de son parent : le chemin arrière se relit donc dans
+* l'ordre des poussées. Chaque couche étant terminée avant de conclure, la
+* rencontre retenue donne le moins de poussées possible.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bidirectionnel.h"
+
+// Noeuds d'une couche de la recherche en largeur
+typedef struct {
+    long *indices;
+    long nbIndices;
+    long capacite;
+} t_couche;
+
+// Meilleure jonction trouvée entre les deux recherches
+typedef struct {
+    long avant; // noeud de la recherche depuis le départ
+    long arriere; // noeud de la recherche depuis les positions résolues
+    int caisse; // poussée de avant vers arriere (-1 : même état)
+    int direction;
+    int cout; // poussées de la solution, -1 si aucune jonction
+} t_rencontre;
+
+/* Fonctions internes */
+
+void ajouter_couche(t_couche *couche, long indice);
+void noter_rencontre(t_recherche *recherche, t_rencontre *rencontre,
+    long avant, long arriere, t_poussee poussee);
+void visiter_etat(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long parent, t_etat *etat, t_poussee poussee,
+    t_couche *suivante, t_rencontre *rencontre);
+void placer_positions_finales(t_niveau *niveau, t_recherche *recherche,
+    t_couche *couche, t_rencontre *rencontre);
+void developper_avant(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, t_couche *suivante,
+    t_rencontre *rencontre);
+void tirer_caisse(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, int joueur, int direction,
+    t_couche *suivante, t_rencontre *rencontre);
+void developper_arriere(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, t_couche *suivante,
+    t_rencontre *rencontre);
+int relier_chemins(t_recherche *recherche, t_rencontre *rencontre,
+    t_poussee poussees[]);
+
+/**
+*
+* @brief Ajouter un noeud à une couche
+* @param couche de type t_couche, Entrée/Sortie : couche
+* @param indice de type entier long, Entrée : noeud à ajouter
+*/
+void ajouter_couche(t_couche *couche, long indice)
+{
+    if(couche->nbIndices == couche->capacite){
+        couche->capacite = couche->capacite == 0 ? 1024 :
+            couche->capacite * 2;
+        couche->indices = realloc(couche->indices,
+            sizeof(long) * couche->capacite);
+    }
+
+    couche->indices[couche->nbIndices++] = indice;
+}
+
+/**
+*
+* @brief Retenir une jonction si elle est plus courte que la meilleure
+* @param recherche de type t_recherche, Entrée : recherche
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+* @param avant de type entier long, Entrée : noeud avant
+* @param arriere de type entier long, Entrée : noeud arrière
+* @param poussee de type t_poussee, Entrée : poussée qui relie les deux
+*   noeuds (caisse à -1 s'ils ont le même état)
+*/
+void noter_rencontre(t_recherche *recherche, t_rencontre *rencontre,
+    long avant, long arriere, t_poussee poussee)
+{
+    int cout = recherche->noeuds[avant].poussees +
+        recherche->noeuds[arriere].poussees + (poussee.caisse >= 0);
+
+    if(rencontre->cout < 0 || cout < rencontre->cout){
+        rencontre->avant = avant;
+        rencontre->arriere = arriere;
+        rencontre->caisse = poussee.caisse;
+        rencontre->direction = poussee.direction;
+        rencontre->cout = cout;
+    }
+}
+
+/**
+*
+* @brief Ajouter l'état obtenu depuis un noeud à la couche suivante, ou
+*   noter la jonction si l'autre recherche l'a déjà rencontré
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param parent de type entier long, Entrée : noeud développé
+* @param etat de type t_etat, Entrée : état obtenu
+* @param poussee de type t_poussee, Entrée : poussée entre les deux états
+*   (du parent vers l'état en avant, de l'état vers le parent en arrière)
+* @param suivante de type t_couche, Entrée/Sortie : couche suivante
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+*/
+void visiter_etat(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long parent, t_etat *etat, t_poussee poussee,
+    t_couche *suivante, t_rencontre *rencontre)
+{
+    bool arriere = recherche->noeuds[parent].arriere;
+    long existant = chercher_etat(recherche, etat);
+    int deplacee = arriere ? poussee.caisse :
+        niveau->voisin[poussee.caisse][poussee.direction];
+
+    if(existant >= 0 && recherche->noeuds[existant].arriere != arriere){
+        noter_rencontre(recherche, rencontre, arriere ? existant : parent,
+            arriere ? parent : existant, poussee);
+    }
+    else if(existant < 0 && !caisse_figee(niveau, options->motifs,
+        &etat->caisses, deplacee)){
+        existant = ajouter_etat(recherche, etat, parent, poussee.caisse,
+            poussee.direction);
+        recherche->noeuds[existant].arriere = arriere;
+        recherche->noeuds[existant].poussees =
+            recherche->noeuds[parent].poussees + 1;
+        ajouter_couche(suivante, existant);
+    }
+}
+
+/**
+*
+* @brief Créer les positions résolues : les caisses sur les cibles et le
+*   joueur dans chacune des zones qu'il peut occuper
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param couche de type t_couche, Sortie : première couche arrière
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+*/
+void placer_positions_finales(t_niveau *niveau, t_recherche *recherche,
+    t_couche *couche, t_rencontre *rencontre)
+{
+    bool interieur[NB_CASES];
+    bool atteint[NB_CASES];
+    bool vue[NB_CASES] = {false};
+    t_caisses vide = {{0}};
+    t_poussee aucune = {-1, 0};
+    t_etat etat;
+    long indice;
+
+    // Cases que le joueur peut atteindre depuis le départ sans caisses
+    zone_joueur(niveau, &vide, niveau->joueurDepart, interieur);
+    etat.caisses = niveau->cibles;
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        if(interieur[numCase] && !vue[numCase] &&
+            case_libre(niveau, &etat.caisses, numCase)){
+            etat.joueur = zone_joueur(niveau, &etat.caisses, numCase,
+                atteint);
+            for(int i = 0 ; i < NB_CASES ; i++){
+                vue[i] = vue[i] || atteint[i];
+            }
+
+            indice = chercher_etat(recherche, &etat);
+            if(indice >= 0){
+                // Le départ est déjà résolu
+                noter_rencontre(recherche, rencontre, indice, indice, aucune);
+            }
+            else{
+                indice = ajouter_etat(recherche, &etat, -1, 0, 0);
+                recherche->noeuds[indice].arriere = true;
+                ajouter_couche(couche, indice);
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Créer tous les noeuds atteignables en une poussée (recherche
+*   depuis le départ)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param indice de type entier long, Entrée : noeud à développer
+* @param suivante de type t_couche, Entrée/Sortie : couche suivante
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+*/
+void developper_avant(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, t_couche *suivante,
+    t_rencontre *rencontre)
+{
+    bool atteint[NB_CASES];
+    bool zoneEnfant[NB_CASES];
+    t_etat etat = recherche->noeuds[indice].etat;
+    t_etat enfant;
+    t_poussee poussee;
+
+    recherche->noeuds[indice].developpe = true;
+    zone_joueur(niveau, &etat.caisses, etat.joueur, atteint);
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        for(int dir = 0 ; atteint[numCase] && dir < NB_DIRECTIONS ; dir++){
+            poussee.caisse = niveau->voisin[numCase][dir];
+            poussee.direction = dir;
+
+            if(poussee_possible(niveau, &etat.caisses, poussee.caisse, dir)){
+                enfant.caisses = etat.caisses;
+                retirer_case(&enfant.caisses, poussee.caisse);
+                ajouter_case(&enfant.caisses,
+                    niveau->voisin[poussee.caisse][dir]);
+                enfant.joueur = zone_joueur(niveau, &enfant.caisses,
+                    poussee.caisse, zoneEnfant);
+                visiter_etat(niveau, recherche, options, indice, &enfant,
+                    poussee, suivante, rencontre);
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Tirer vers le joueur la caisse placée devant lui, s'il a la place
+*   de reculer (inverse d'une poussée)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param indice de type entier long, Entrée : noeud développé
+* @param joueur de type entier, Entrée : case du joueur
+* @param direction de type entier, Entrée : direction de la caisse vue du
+*   joueur
+* @param suivante de type t_couche, Entrée/Sortie : couche suivante
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+*/
+void tirer_caisse(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, int joueur, int direction,
+    t_couche *suivante, t_rencontre *rencontre)
+{
+    bool atteint[NB_CASES];
+    t_etat parent = recherche->noeuds[indice].etat;
+    t_etat enfant = parent;
+    // La poussée inverse : depuis derriere, le joueur pousse la caisse
+    // de sa case vers la case de départ de la caisse tirée
+    t_poussee poussee = {joueur, direction};
+    int caisse = niveau->voisin[joueur][direction];
+    int derriere = niveau->voisin[joueur][direction ^ 1];
+
+    if(caisse >= 0 && case_occupee(&parent.caisses, caisse) &&
+        case_libre(niveau, &parent.caisses, derriere) &&
+        !niveau->caseMorte[joueur]){
+        retirer_case(&enfant.caisses, caisse);
+        ajouter_case(&enfant.caisses, joueur);
+        enfant.joueur = zone_joueur(niveau, &enfant.caisses, derriere,
+            atteint);
+        visiter_etat(niveau, recherche, options, indice, &enfant, poussee,
+            suivante, rencontre);
+    }
+}
+
+/**
+*
+* @brief Créer tous les noeuds atteignables en un tirage (recherche depuis
+*   les positions résolues)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param indice de type entier long, Entrée : noeud à développer
+* @param suivante de type t_couche, Entrée/Sortie : couche suivante
+* @param rencontre de type t_rencontre, Entrée/Sortie : meilleure jonction
+*/
+void developper_arriere(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long indice, t_couche *suivante,
+    t_rencontre *rencontre)
+{
+    bool atteint[NB_CASES];
+    t_etat etat = recherche->noeuds[indice].etat;
+
+    recherche->noeuds[indice].developpe = true;
+    zone_joueur(niveau, &etat.caisses, etat.joueur, atteint);
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        for(int dir = 0 ; atteint[numCase] && dir < NB_DIRECTIONS ; dir++){
+            tirer_caisse(niveau, recherche, options, indice, numCase, dir,
+                suivante, rencontre);
+        }
+    }
+}
+
+/**
+*
+* @brief Mettre bout à bout les poussées du départ à la jonction puis de la
+*   jonction à la position résolue
+* @param recherche de type t_recherche, Entrée : recherche terminée
+* @param rencontre de type t_rencontre, Entrée : jonction retenue
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+*   (rencontre->cout au plus)
+* @return entier : nombre de poussées
+*/
+int relier_chemins(t_recherche *recherche, t_rencontre *rencontre,
+    t_poussee poussees[])
+{
+    t_noeud *noeud;
+    int nbPoussees = recherche->noeuds[rencontre->avant].poussees;
+
+    // Chemin avant, relu à l'envers depuis la jonction
+    for(long i = rencontre->avant ; recherche->noeuds[i].parent >= 0 ;
+        i = recherche->noeuds[i].parent){
+        noeud = &recherche->noeuds[i];
+        nbPoussees--;
+        poussees[nbPoussees].caisse = noeud->caisse;
+        poussees[nbPoussees].direction = noeud->direction;
+    }
+
+    nbPoussees = recherche->noeuds[rencontre->avant].poussees;
+    if(rencontre->caisse >= 0){
+        poussees[nbPoussees].caisse = rencontre->caisse;
+        poussees[nbPoussees++].direction = rencontre->direction;
+    }
+
+    // Chemin arrière, déjà dans l'ordre des poussées
+    for(long i = rencontre->arriere ; recherche->noeuds[i].parent >= 0 ;
+        i = recherche->noeuds[i].parent){
+        noeud = &recherche->noeuds[i];
+        poussees[nbPoussees].caisse = noeud->caisse;
+        poussees[nbPoussees++].direction = noeud->direction;
+    }
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Chercher une solution en avançant depuis le départ et en reculant
+*   depuis les positions résolues (le niveau doit avoir autant de caisses
+*   que de cibles)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche vide
+* @param options de type t_optionsSolveur, Entrée : réglages (seuls la
+*   limite de noeuds et la base de motifs sont utilisés)
+* @param solution de type chaîne de caractères, Sortie : solution
+* @return entier : longueur de la solution, -1 si aucune n'est trouvée
+*/
+int chercher_bidirectionnel(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, char solution[])
+{
+    t_couche couches[2][2] = {{{NULL, 0, 0}, {NULL, 0, 0}},
+        {{NULL, 0, 0}, {NULL, 0, 0}}};
+    t_rencontre rencontre = {-1, -1, -1, 0, -1};
+    t_couche *courante, *suivante, echange;
+    t_poussee *poussees;
+    int sens;
+    int longueur = -1;
+
+    // couches[0] : recherche avant, couches[1] : recherche arrière
+    ajouter_etat(recherche, &niveau->depart, -1, 0, 0);
+    recherche->noeuds[0].arriere = false;
+    ajouter_couche(&couches[0][0], 0);
+    placer_positions_finales(niveau, recherche, &couches[1][0], &rencontre);
+
+    while(rencontre.cout < 0 && couches[0][0].nbIndices > 0 &&
+        couches[1][0].nbIndices > 0 &&
+        recherche->nbNoeuds < options->limiteNoeuds){
+        sens = couches[1][0].nbIndices < couches[0][0].nbIndices;
+        courante = &couches[sens][0];
+        suivante = &couches[sens][1];
+
+        for(long i = 0 ; i < courante->nbIndices ; i++){
+            if(sens == 0){
+                developper_avant(niveau, recherche, options,
+                    courante->indices[i], suivante, &rencontre);
+            }
+            else{
+                developper_arriere(niveau, recherche, options,
+                    courante->indices[i], suivante, &rencontre);
+            }
+        }
+
+        echange = *courante;
+        *courante = *suivante;
+        *suivante = echange;
+        suivante->nbIndices = 0;
+    }
+
+    if(rencontre.cout >= 0){
+        poussees = malloc(sizeof(t_poussee) * (rencontre.cout + 1));
+        longueur = ecrire_poussees(niveau, poussees,
+            relier_chemins(recherche, &rencontre, poussees), solution);
+        free(poussees);
+    }
+
+    for(sens = 0 ; sens < 2 ; sens++){
+        free(couches[sens][0].indices);
+        free(couches[sens][1].indices);
+    }
+
+    return longueur;
+}
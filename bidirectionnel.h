@@ -0,0 +1,25 @@
+/**
+* @file bidirectionnel.h
+* @brief Recherche bidirectionnelle : poussées depuis le départ et tirages
+*   depuis les positions résolues
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* La recherche arrière part de toutes les positions résolues (une par zone
+* où le joueur peut finir) et tire les caisses : tirer une caisse est
+* l'inverse exact d'une poussée. Les deux recherches avancent en largeur,
+* couche par couche, en développant toujours la plus petite des deux, et
+* partagent la même table d'états : un état créé par une recherche et
+* retrouvé par l'autre relie le départ à la solution.
+*/
+
+#ifndef BIDIRECTIONNEL_H
+#define BIDIRECTIONNEL_H
+
+#include "solveur.h"
+
+int chercher_bidirectionnel(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, char solution[]);
+
+#endif
@@ -0,0 +1,650 @@
+/**
+* @file cache.c
+* @brief Cache sur disque des solutions déjà trouvées
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Les solutions lues sont vérifiées avant d'être rendues : un fichier
+* abîmé ou une collision d'empreintes ne donnent jamais de poussée
+* impossible. Toutes les fonctions publiques prennent le verrou du cache.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+#include "cache.h"
+
+#define CACHE_SIGNATURE     "SKSC"
+#define SOLUTIONS_INITIALES 64
+#define ENTETE_SOLUTION     8 // poussées, déplacements, noeuds
+
+/* Fonctions internes */
+
+char contenu_normalise(t_niveau *niveau, int numCase, bool utile[],
+    bool zone[]);
+void normaliser_niveau(t_niveau *niveau, t_forme *forme);
+int direction_entre(int ligneA, int colonneA, int ligneB, int colonneB);
+t_poussee poussee_vers_forme(t_niveau *niveau, t_forme *forme,
+    t_poussee poussee);
+t_poussee poussee_vers_plateau(t_niveau *niveau, t_forme *forme,
+    t_poussee poussee);
+bool poussees_valides(t_niveau *niveau, t_poussee poussees[],
+    int nbPoussees);
+long place_solution(t_cache *cache, uint64_t empreinte, t_forme *forme);
+void agrandir_cache(t_cache *cache);
+bool ranger_solution(t_cache *cache, t_solutionConnue *solution);
+void ecrire_entier(unsigned char octets[], long valeur, int nbOctets);
+long lire_entier(unsigned char octets[], int nbOctets);
+bool lire_solution(FILE *fichier, t_solutionConnue *solution);
+void ecrire_solution(int fichier, t_solutionConnue *solution);
+bool lire_cache(t_cache *cache);
+
+/**
+*
+* @brief Calculer le contenu d'une case dans la version normalisée d'une
+*   position
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param numCase de type entier, Entrée : case
+* @param utile de type tableau de booléens, Entrée : cases atteignables en
+*   ignorant les caisses, caisses et cibles
+* @param zone de type tableau de booléens, Entrée : zone du joueur
+* @return caractère : contenu normalisé de la case
+*/
+char contenu_normalise(t_niveau *niveau, int numCase, bool utile[],
+    bool zone[])
+{
+    bool caisse = case_occupee(&niveau->depart.caisses, numCase);
+    bool cible = case_occupee(&niveau->cibles, numCase);
+    char contenu = VIDE;
+    int voisine;
+
+    if(caisse){
+        contenu = cible ? CAISSE_SUR_CIBLE : CAISSE;
+    }
+    else if(zone[numCase]){
+        contenu = cible ? PLAYER_SUR_CIBLE : PLAYER;
+    }
+    else if(cible){
+        contenu = CIBLE;
+    }
+    else if(niveau->mur[numCase]){
+        // Un mur ne compte que s'il borde une case utile
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            voisine = niveau->voisin[numCase][dir];
+            if(voisine >= 0 && utile[voisine]){
+                contenu = MUR;
+            }
+        }
+    }
+
+    return contenu;
+}
+
+/**
+*
+* @brief Calculer la forme canonique de la version normalisée d'une
+*   position
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param forme de type t_forme*, Sortie : forme canonique
+*/
+void normaliser_niveau(t_niveau *niveau, t_forme *forme)
+{
+    t_caisses aucune;
+    t_plateau plateau;
+    bool interieur[NB_CASES];
+    bool zone[NB_CASES];
+    bool utile[NB_CASES];
+
+    memset(&aucune, 0, sizeof(t_caisses));
+    zone_joueur(niveau, &aucune, niveau->joueurDepart, interieur);
+    zone_joueur(niveau, &niveau->depart.caisses, niveau->joueurDepart, zone);
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        utile[numCase] = interieur[numCase] ||
+            case_occupee(&niveau->depart.caisses, numCase) ||
+            case_occupee(&niveau->cibles, numCase);
+    }
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        plateau[numCase / TAILLE][numCase % TAILLE] =
+            contenu_normalise(niveau, numCase, utile, zone);
+    }
+
+    canoniser_plateau(plateau, forme);
+}
+
+/**
+*
+* @brief Trouver la direction qui mène d'une case à sa voisine
+* @param ligneA de type entier, Entrée : ligne de la case de départ
+* @param colonneA de type entier, Entrée : colonne de la case de départ
+* @param ligneB de type entier, Entrée : ligne de la case voisine
+* @param colonneB de type entier, Entrée : colonne de la case voisine
+* @return entier : direction (haut, bas, gauche, droite)
+*/
+int direction_entre(int ligneA, int colonneA, int ligneB, int colonneB)
+{
+    int direction;
+
+    if(ligneB != ligneA){
+        direction = ligneB < ligneA ? 0 : 1;
+    }
+    else{
+        direction = colonneB < colonneA ? 2 : 3;
+    }
+
+    return direction;
+}
+
+/**
+*
+* @brief Traduire une poussée du plateau en poussée de la forme
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param forme de type t_forme*, Entrée : forme de cette position
+* @param poussee de type t_poussee, Entrée : poussée possible
+* @return t_poussee : poussée dans les cases de la forme
+*/
+t_poussee poussee_vers_forme(t_niveau *niveau, t_forme *forme,
+    t_poussee poussee)
+{
+    t_poussee traduite;
+    int arrivee = niveau->voisin[poussee.caisse][poussee.direction];
+    int ligne = poussee.caisse / TAILLE;
+    int colonne = poussee.caisse % TAILLE;
+    int ligneArrivee = arrivee / TAILLE;
+    int colonneArrivee = arrivee % TAILLE;
+
+    case_vers_forme(forme, &ligne, &colonne);
+    case_vers_forme(forme, &ligneArrivee, &colonneArrivee);
+    traduite.caisse = ligne * TAILLE + colonne;
+    traduite.direction = direction_entre(ligne, colonne, ligneArrivee,
+        colonneArrivee);
+
+    return traduite;
+}
+
+/**
+*
+* @brief Traduire une poussée de la forme en poussée du plateau
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param forme de type t_forme*, Entrée : forme de cette position
+* @param poussee de type t_poussee, Entrée : poussée de la forme
+* @return t_poussee : poussée du plateau (caisse -1 si elle en sort)
+*/
+t_poussee poussee_vers_plateau(t_niveau *niveau, t_forme *forme,
+    t_poussee poussee)
+{
+    t_poussee traduite = {-1, 0};
+    t_poussee essai;
+    int ligne = poussee.caisse / TAILLE;
+    int colonne = poussee.caisse % TAILLE;
+
+    case_vers_plateau(forme, &ligne, &colonne);
+
+    if(ligne >= 0 && ligne < TAILLE && colonne >= 0 && colonne < TAILLE){
+        traduite.caisse = ligne * TAILLE + colonne;
+        // La direction est celle qui redonne la poussée de la forme
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            essai = (t_poussee){traduite.caisse, dir};
+            if(niveau->voisin[traduite.caisse][dir] >= 0 &&
+                poussee_vers_forme(niveau, forme, essai).direction ==
+                poussee.direction){
+                traduite.direction = dir;
+            }
+        }
+    }
+
+    return traduite;
+}
+
+/**
+*
+* @brief Vérifier qu'une suite de poussées est jouable et résout la
+*   position
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param poussees de type tableau de t_poussee, Entrée : poussées
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @return vrai si chaque poussée est possible et la fin résolue
+*/
+bool poussees_valides(t_niveau *niveau, t_poussee poussees[],
+    int nbPoussees)
+{
+    t_caisses caisses = niveau->depart.caisses;
+    bool atteint[NB_CASES];
+    int joueur = niveau->joueurDepart;
+    int caisse, derriere, arrivee;
+    bool valide = true;
+
+    for(int i = 0 ; valide && i < nbPoussees ; i++){
+        caisse = poussees[i].caisse;
+        derriere = caisse < 0 ? -1 :
+            niveau->voisin[caisse][poussees[i].direction ^ 1];
+        arrivee = caisse < 0 ? -1 :
+            niveau->voisin[caisse][poussees[i].direction];
+        zone_joueur(niveau, &caisses, joueur, atteint);
+
+        valide = caisse >= 0 && case_occupee(&caisses, caisse) &&
+            derriere >= 0 && atteint[derriere] &&
+            case_libre(niveau, &caisses, arrivee);
+        if(valide){
+            retirer_case(&caisses, caisse);
+            ajouter_case(&caisses, arrivee);
+            joueur = caisse;
+        }
+    }
+
+    return valide && est_resolu(niveau, &caisses);
+}
+
+/**
+*
+* @brief Trouver la place d'une forme dans la table
+* @param cache de type t_cache, Entrée : cache
+* @param empreinte de type entier 64 bits, Entrée : empreinte de la forme
+* @param forme de type t_forme*, Entrée : forme cherchée
+* @return entier long : place de la forme, ou place libre où la ranger
+*/
+long place_solution(t_cache *cache, uint64_t empreinte, t_forme *forme)
+{
+    long masque = cache->tailleTable - 1;
+    long place = (long)(empreinte & (uint64_t)masque);
+    t_solutionConnue *solution;
+    bool trouvee = false;
+
+    while(!trouvee && cache->table[place] != 0){
+        solution = &cache->solutions[cache->table[place] - 1];
+        trouvee = solution->empreinte == empreinte &&
+            formes_egales(&solution->forme, forme);
+        if(!trouvee){
+            place = (place + 1) & masque;
+        }
+    }
+
+    return place;
+}
+
+/**
+*
+* @brief Doubler la table et le tableau des solutions
+* @param cache de type t_cache, Entrée/Sortie : cache
+*/
+void agrandir_cache(t_cache *cache)
+{
+    t_solutionConnue *solution;
+
+    cache->capacite *= 2;
+    cache->solutions = realloc(cache->solutions,
+        sizeof(t_solutionConnue) * cache->capacite);
+
+    free(cache->table);
+    cache->tailleTable *= 2;
+    cache->table = calloc(cache->tailleTable, sizeof(long));
+
+    for(long i = 0 ; i < cache->nbSolutions ; i++){
+        solution = &cache->solutions[i];
+        cache->table[place_solution(cache, solution->empreinte,
+            &solution->forme)] = i + 1;
+    }
+}
+
+/**
+*
+* @brief Garder une solution si sa forme est nouvelle ou si elle est
+*   meilleure que celle connue
+* @param cache de type t_cache, Entrée/Sortie : cache
+* @param solution de type t_solutionConnue, Entrée : solution (ses
+*   poussées appartiennent ensuite au cache, ou sont libérées)
+* @return vrai si la solution est gardée
+*/
+bool ranger_solution(t_cache *cache, t_solutionConnue *solution)
+{
+    t_solutionConnue *connue;
+    long place;
+    bool gardee = true;
+
+    if(cache->nbSolutions * 2 >= cache->tailleTable){
+        agrandir_cache(cache);
+    }
+    place = place_solution(cache, solution->empreinte, &solution->forme);
+
+    if(cache->table[place] == 0){
+        cache->solutions[cache->nbSolutions] = *solution;
+        cache->table[place] = ++cache->nbSolutions;
+    }
+    else{
+        connue = &cache->solutions[cache->table[place] - 1];
+        gardee = solution->nbPoussees < connue->nbPoussees ||
+            (solution->nbPoussees == connue->nbPoussees &&
+            solution->nbDeplacements < connue->nbDeplacements);
+        if(gardee){
+            free(connue->poussees);
+            *connue = *solution;
+        }
+        else{
+            free(solution->poussees);
+        }
+    }
+
+    return gardee;
+}
+
+/**
+*
+* @brief Écrire un entier positif en petit-boutiste (saturé s'il dépasse)
+* @param octets de type tableau d'octets, Sortie : octets écrits
+* @param valeur de type entier long, Entrée : valeur
+* @param nbOctets de type entier, Entrée : nombre d'octets (4 au plus)
+*/
+void ecrire_entier(unsigned char octets[], long valeur, int nbOctets)
+{
+    long maximum = (1L << (8 * nbOctets)) - 1;
+
+    valeur = valeur < 0 ? 0 : valeur > maximum ? maximum : valeur;
+    for(int i = 0 ; i < nbOctets ; i++){
+        octets[i] = (valeur >> (8 * i)) & 0xFF;
+    }
+}
+
+/**
+*
+* @brief Lire un entier positif écrit en petit-boutiste
+* @param octets de type tableau d'octets, Entrée : octets lus
+* @param nbOctets de type entier, Entrée : nombre d'octets (4 au plus)
+* @return entier long : valeur
+*/
+long lire_entier(unsigned char octets[], int nbOctets)
+{
+    long valeur = 0;
+
+    for(int i = nbOctets - 1 ; i >= 0 ; i--){
+        valeur = (valeur << 8) | octets[i];
+    }
+
+    return valeur;
+}
+
+/**
+*
+* @brief Lire la solution suivante du fichier
+* @param fichier de type FILE*, Entrée : fichier du cache
+* @param solution de type t_solutionConnue, Sortie : solution lue
+* @return vrai si un enregistrement complet a été lu
+*/
+bool lire_solution(FILE *fichier, t_solutionConnue *solution)
+{
+    unsigned char octets[ENTETE_SOLUTION];
+    t_forme *forme = &solution->forme;
+    bool lu = fread(octets, 1, 2, fichier) == 2 &&
+        octets[0] <= TAILLE && octets[1] <= TAILLE;
+
+    memset(solution, 0, sizeof(t_solutionConnue));
+    memset(forme->cases, VIDE, sizeof(t_plateau));
+    forme->nbLignes = octets[0];
+    forme->nbColonnes = octets[1];
+    for(int ligne = 0 ; lu && ligne < forme->nbLignes ; ligne++){
+        lu = (int)fread(forme->cases[ligne], 1, forme->nbColonnes,
+            fichier) == forme->nbColonnes;
+    }
+
+    if(lu && fread(octets, 1, ENTETE_SOLUTION, fichier) == ENTETE_SOLUTION){
+        solution->nbPoussees = lire_entier(octets, 2);
+        solution->nbDeplacements = lire_entier(&octets[2], 2);
+        solution->noeuds = lire_entier(&octets[4], 4);
+        lu = solution->nbPoussees <= TAILLE_SOLUTION_MAX;
+    }
+    else{
+        lu = false;
+    }
+
+    if(lu){
+        solution->poussees = malloc(sizeof(t_poussee) *
+            (solution->nbPoussees + 1));
+        for(int i = 0 ; lu && i < solution->nbPoussees ; i++){
+            lu = fread(octets, 1, 2, fichier) == 2 &&
+                octets[0] < NB_CASES && octets[1] < NB_DIRECTIONS;
+            solution->poussees[i] = (t_poussee){octets[0], octets[1]};
+        }
+        if(!lu){
+            free(solution->poussees);
+        }
+    }
+    solution->empreinte = lu ? hacher_forme(forme) : 0;
+
+    return lu;
+}
+
+/**
+*
+* @brief Ajouter une solution à la fin du fichier
+* @param fichier de type entier, Entrée : descripteur du cache ouvert en
+*   ajout
+* @param solution de type t_solutionConnue, Entrée : solution à écrire
+*/
+void ecrire_solution(int fichier, t_solutionConnue *solution)
+{
+    t_forme *forme = &solution->forme;
+    unsigned char *octets = malloc(2 + NB_CASES + ENTETE_SOLUTION +
+        2 * solution->nbPoussees);
+    int taille = 0;
+    struct stat infos;
+
+    octets[taille++] = forme->nbLignes;
+    octets[taille++] = forme->nbColonnes;
+    for(int ligne = 0 ; ligne < forme->nbLignes ; ligne++){
+        memcpy(&octets[taille], forme->cases[ligne], forme->nbColonnes);
+        taille += forme->nbColonnes;
+    }
+    ecrire_entier(&octets[taille], solution->nbPoussees, 2);
+    ecrire_entier(&octets[taille + 2], solution->nbDeplacements, 2);
+    ecrire_entier(&octets[taille + 4], solution->noeuds, 4);
+    taille += ENTETE_SOLUTION;
+    for(int i = 0 ; i < solution->nbPoussees ; i++){
+        octets[taille++] = solution->poussees[i].caisse;
+        octets[taille++] = solution->poussees[i].direction;
+    }
+
+    // Un seul write par solution, sous le verrou : les ajouts des autres
+    // processus ne s'y mêlent pas, et une écriture incomplète est retirée
+    if(flock(fichier, LOCK_EX) == 0){
+        if(fstat(fichier, &infos) == 0 &&
+            write(fichier, octets, taille) != taille){
+            ftruncate(fichier, infos.st_size);
+        }
+        flock(fichier, LOCK_UN);
+    }
+    free(octets);
+}
+
+/**
+*
+* @brief Ranger les solutions du fichier et retirer un enregistrement
+*   incomplet à sa fin (le verrou exclusif du fichier doit être pris)
+* @param cache de type t_cache, Entrée/Sortie : cache
+* @return vrai si le fichier est un cache
+*/
+bool lire_cache(t_cache *cache)
+{
+    unsigned char entete[CACHE_TAILLE_ENTETE];
+    t_solutionConnue solution;
+    // Copie du descripteur : fclose ne ferme pas le cache
+    FILE *entree = fdopen(dup(cache->fichier), "rb");
+    long valide = 0;
+
+    if(entree != NULL){
+        if(fread(entete, 1, CACHE_TAILLE_ENTETE, entree) ==
+            CACHE_TAILLE_ENTETE &&
+            memcmp(entete, CACHE_SIGNATURE, 4) == 0 &&
+            entete[4] == CACHE_VERSION){
+            valide = CACHE_TAILLE_ENTETE;
+        }
+        while(valide > 0 && lire_solution(entree, &solution)){
+            ranger_solution(cache, &solution);
+            valide = ftell(entree);
+        }
+        fclose(entree);
+    }
+
+    return valide > 0 && ftruncate(cache->fichier, valide) == 0;
+}
+
+/**
+*
+* @brief Charger le cache et l'ouvrir en ajout (le fichier est créé s'il
+*   n'existe pas)
+* @param fichier de type chaîne de caractères, Entrée : fichier du cache
+* @param cache de type t_cache, Sortie : cache (vide et en mémoire
+*   seulement si le fichier n'est pas un cache ou ne peut pas être écrit)
+* @return vrai si le fichier est utilisé
+*/
+bool ouvrir_cache(char fichier[], t_cache *cache)
+{
+    unsigned char entete[CACHE_TAILLE_ENTETE] = CACHE_SIGNATURE;
+    struct stat infos;
+    bool valide = false;
+
+    memset(cache, 0, sizeof(t_cache));
+    pthread_mutex_init(&cache->verrou, NULL);
+    cache->capacite = SOLUTIONS_INITIALES;
+    cache->solutions = malloc(sizeof(t_solutionConnue) * cache->capacite);
+    cache->tailleTable = SOLUTIONS_INITIALES * 2;
+    cache->table = calloc(cache->tailleTable, sizeof(long));
+
+    cache->fichier = open(fichier, O_RDWR | O_CREAT | O_APPEND, 0644);
+    entete[4] = CACHE_VERSION;
+
+    if(cache->fichier >= 0 && flock(cache->fichier, LOCK_EX) == 0){
+        // Fichier neuf, ou arrêté avant la fin de son en-tête
+        if(fstat(cache->fichier, &infos) == 0 &&
+            infos.st_size < CACHE_TAILLE_ENTETE &&
+            ftruncate(cache->fichier, 0) == 0){
+            valide = write(cache->fichier, entete, CACHE_TAILLE_ENTETE) ==
+                CACHE_TAILLE_ENTETE;
+        }
+        else{
+            valide = lire_cache(cache);
+        }
+        flock(cache->fichier, LOCK_UN);
+    }
+
+    if(!valide && cache->fichier >= 0){
+        close(cache->fichier);
+        cache->fichier = -1;
+    }
+
+    return cache->fichier >= 0;
+}
+
+/**
+*
+* @brief Fermer le fichier et libérer le cache
+* @param cache de type t_cache, Entrée/Sortie : cache à fermer
+*/
+void fermer_cache(t_cache *cache)
+{
+    if(cache->fichier >= 0){
+        close(cache->fichier);
+    }
+    for(long i = 0 ; i < cache->nbSolutions ; i++){
+        free(cache->solutions[i].poussees);
+    }
+    free(cache->solutions);
+    free(cache->table);
+    pthread_mutex_destroy(&cache->verrou);
+    memset(cache, 0, sizeof(t_cache));
+    cache->fichier = -1;
+}
+
+/**
+*
+* @brief Chercher la solution connue d'une position
+* @param cache de type t_cache, Entrée : cache
+* @param niveau de type t_niveau, Entrée : position analysée
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+* @param nbMax de type entier, Entrée : nombre maximal de poussées
+* @param stats de type t_statsSolveur, Sortie : enCache et noeudsExplores
+*   (NULL : ignorées)
+* @return entier : nombre de poussées (nbMax au plus), -1 si aucune
+*   solution n'est connue
+*/
+int consulter_cache(t_cache *cache, t_niveau *niveau, t_poussee poussees[],
+    int nbMax, t_statsSolveur *stats)
+{
+    t_forme forme;
+    t_solutionConnue *connue;
+    t_poussee *traduites = NULL;
+    uint64_t empreinte;
+    long place;
+    int nbPoussees = -1;
+
+    normaliser_niveau(niveau, &forme);
+    empreinte = hacher_forme(&forme);
+
+    pthread_mutex_lock(&cache->verrou);
+    place = place_solution(cache, empreinte, &forme);
+    if(cache->table[place] != 0){
+        connue = &cache->solutions[cache->table[place] - 1];
+        traduites = malloc(sizeof(t_poussee) * (connue->nbPoussees + 1));
+        for(int i = 0 ; i < connue->nbPoussees ; i++){
+            traduites[i] = poussee_vers_plateau(niveau, &forme,
+                connue->poussees[i]);
+        }
+        if(poussees_valides(niveau, traduites, connue->nbPoussees)){
+            nbPoussees = connue->nbPoussees < nbMax ?
+                connue->nbPoussees : nbMax;
+            memcpy(poussees, traduites, sizeof(t_poussee) * nbPoussees);
+        }
+        if(nbPoussees >= 0 && stats != NULL){
+            stats->enCache = true;
+            stats->noeudsExplores = connue->noeuds;
+        }
+    }
+    pthread_mutex_unlock(&cache->verrou);
+
+    free(traduites);
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Retenir une solution trouvée (ajoutée au fichier si sa forme est
+*   nouvelle ou si elle fait mieux que celle connue)
+* @param cache de type t_cache, Entrée/Sortie : cache
+* @param niveau de type t_niveau, Entrée : position résolue
+* @param poussees de type tableau de t_poussee, Entrée : solution complète
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @param nbDeplacements de type entier, Entrée : déplacements écrits pour
+*   ces poussées depuis la position
+* @param noeuds de type entier long, Entrée : noeuds explorés pour la
+*   trouver
+*/
+void enrichir_cache(t_cache *cache, t_niveau *niveau, t_poussee poussees[],
+    int nbPoussees, int nbDeplacements, long noeuds)
+{
+    t_solutionConnue solution;
+
+    normaliser_niveau(niveau, &solution.forme);
+    solution.empreinte = hacher_forme(&solution.forme);
+    solution.nbPoussees = nbPoussees;
+    solution.nbDeplacements = nbDeplacements;
+    solution.noeuds = noeuds;
+    solution.poussees = malloc(sizeof(t_poussee) * (nbPoussees + 1));
+    for(int i = 0 ; i < nbPoussees ; i++){
+        solution.poussees[i] = poussee_vers_forme(niveau, &solution.forme,
+            poussees[i]);
+    }
+
+    pthread_mutex_lock(&cache->verrou);
+    if(ranger_solution(cache, &solution) && cache->fichier >= 0){
+        ecrire_solution(cache->fichier, &solution);
+    }
+    pthread_mutex_unlock(&cache->verrou);
+}
@@ -0,0 +1,78 @@
+/**
+* @file cache.h
+* @brief Cache sur disque des solutions déjà trouvées
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Une position est rangée sous la forme canonique (voir canonique.h) de sa
+* version normalisée : les cases que ni le joueur ni une caisse ne peuvent
+* atteindre sont vidées, les murs qui ne bordent rien d'utile retirés, et
+* le joueur est remplacé par toute sa zone (@ ou + sur chaque case
+* atteignable). Deux positions qui ne diffèrent que par la case exacte du
+* joueur, un décalage, une rotation ou un retournement partagent donc leur
+* solution, gardée sous forme de poussées (cases de la forme).
+*
+* Le fichier n'est jamais réécrit : chaque solution nouvelle ou meilleure
+* (moins de poussées, puis moins de déplacements) y est ajoutée, et la
+* lecture garde la meilleure de chaque forme dans une table en mémoire.
+* Un enregistrement incomplet en fin de fichier (arrêt pendant l'écriture)
+* est retiré à l'ouverture.
+*
+* Plusieurs processus (jeux, solveur) peuvent ajouter des solutions en
+* même temps : chaque solution est écrite d'un seul write, en ajout, sous
+* un verrou exclusif du fichier (flock), et le fichier n'est coupé que
+* sous ce verrou.
+*
+* Format : "SKSC", version, 3 octets nuls, puis pour chaque solution
+* (entiers en petit-boutiste) : lignes (1 octet), colonnes (1), cases de
+* la forme ligne par ligne, poussées (2), déplacements (2), noeuds
+* explorés (4), puis chaque poussée : case (ligne * TAILLE + colonne, 1)
+* et direction (1).
+*/
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "canonique.h"
+
+#define CACHE_VERSION       1
+#define CACHE_TAILLE_ENTETE 8
+#define FICHIER_CACHE       "bin/solutions.db"
+
+// Meilleure solution connue d'une forme
+typedef struct {
+    uint64_t empreinte;
+    t_forme forme;
+    int nbPoussees;
+    int nbDeplacements; // depuis la position où elle a été trouvée
+    long noeuds; // noeuds explorés par la recherche qui l'a trouvée
+    t_poussee *poussees; // cases et directions de la forme
+} t_solutionConnue;
+
+// Cache partagé entre threads (type déclaré dans solveur.h)
+struct s_cache {
+    pthread_mutex_t verrou;
+    int fichier; // ouvert en ajout, -1 : cache en mémoire seulement
+    t_solutionConnue *solutions;
+    long nbSolutions;
+    long capacite;
+    long *table; // indice de la solution + 1, 0 si la place est libre
+    long tailleTable;
+};
+
+bool ouvrir_cache(char fichier[], t_cache *cache);
+void fermer_cache(t_cache *cache);
+int consulter_cache(t_cache *cache, t_niveau *niveau, t_poussee poussees[],
+    int nbMax, t_statsSolveur *stats);
+void enrichir_cache(t_cache *cache, t_niveau *niveau, t_poussee poussees[],
+    int nbPoussees, int nbDeplacements, long noeuds);
+
+#endif
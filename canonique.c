@@ -0,0 +1,257 @@
+/**
+* @file canonique.c
+* @brief Forme canonique d'un niveau, pour repérer les doublons
+* @author Liam CHARPENTIER
+* @version 2
+* @date 19/10/2026
+*
+* Une symétrie est codée sur 3 bits : échange des lignes et des colonnes
+* (4), retournement vertical (1) puis horizontal (2) du niveau recadré.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "canonique.h"
+
+#define FNV_BASE     14695981039346656037ULL
+#define FNV_PREMIER  1099511628211ULL
+
+/* Fonctions internes */
+
+char contenu_forme(char contenu);
+void recadrer_plateau(t_plateau plateau, t_forme *forme);
+void appliquer_symetrie(t_forme *source, int symetrie, t_forme *image);
+int comparer_formes(t_forme *formeA, t_forme *formeB);
+
+/**
+*
+* @brief Récupérer ce qu'une case apporte au niveau
+* @param contenu de type caractère, Entrée : octet lu dans le plateau
+* @return caractère : le contenu s'il fait partie du niveau, VIDE sinon
+* Le chargement laisse '\n' et d'autres octets au bout des lignes plus
+* courtes ou plus longues que TAILLE : ils ne font pas partie du niveau
+*/
+char contenu_forme(char contenu)
+{
+    char resultat = VIDE;
+
+    if(contenu == MUR || contenu == CAISSE || contenu == CIBLE ||
+        contenu == CAISSE_SUR_CIBLE || contenu == PLAYER ||
+        contenu == PLAYER_SUR_CIBLE){
+        resultat = contenu;
+    }
+
+    return resultat;
+}
+
+/**
+*
+* @brief Retirer les lignes et colonnes vides autour du niveau
+* @param plateau de type t_plateau, Entrée : niveau chargé
+* @param forme de type t_forme*, Sortie : niveau recadré en haut à gauche
+*/
+void recadrer_plateau(t_plateau plateau, t_forme *forme)
+{
+    int premiereLigne = TAILLE, derniereLigne = -1;
+    int premiereColonne = TAILLE, derniereColonne = -1;
+
+    for(int ligne = 0; ligne < TAILLE; ligne++){
+        for(int colonne = 0; colonne < TAILLE; colonne++){
+            if(contenu_forme(plateau[ligne][colonne]) != VIDE){
+                premiereLigne = ligne < premiereLigne ? ligne : premiereLigne;
+                derniereLigne = ligne;
+                premiereColonne = colonne < premiereColonne ? colonne :
+                    premiereColonne;
+                derniereColonne = colonne > derniereColonne ? colonne :
+                    derniereColonne;
+            }
+        }
+    }
+
+    memset(forme->cases, VIDE, sizeof(t_plateau));
+    forme->ligneOrigine = derniereLigne < 0 ? 0 : premiereLigne;
+    forme->colonneOrigine = derniereColonne < 0 ? 0 : premiereColonne;
+    forme->symetrie = 0;
+    forme->nbLignes = derniereLigne < 0 ? 0 :
+        derniereLigne - premiereLigne + 1;
+    forme->nbColonnes = derniereColonne < 0 ? 0 :
+        derniereColonne - premiereColonne + 1;
+
+    for(int ligne = 0; ligne < forme->nbLignes; ligne++){
+        for(int colonne = 0; colonne < forme->nbColonnes; colonne++){
+            forme->cases[ligne][colonne] = contenu_forme(
+                plateau[premiereLigne + ligne][premiereColonne + colonne]);
+        }
+    }
+}
+
+/**
+*
+* @brief Calculer l'image d'un niveau recadré par une symétrie
+* @param source de type t_forme*, Entrée : niveau recadré
+* @param symetrie de type entier, Entrée : symétrie (0 à NB_SYMETRIES - 1)
+* @param image de type t_forme*, Sortie : niveau transformé
+*/
+void appliquer_symetrie(t_forme *source, int symetrie, t_forme *image)
+{
+    bool echange = (symetrie & 4) != 0;
+    int ligneSource, colonneSource;
+
+    image->ligneOrigine = source->ligneOrigine;
+    image->colonneOrigine = source->colonneOrigine;
+    image->symetrie = symetrie;
+    image->nbLignes = echange ? source->nbColonnes : source->nbLignes;
+    image->nbColonnes = echange ? source->nbLignes : source->nbColonnes;
+    memset(image->cases, VIDE, sizeof(t_plateau));
+
+    for(int ligne = 0; ligne < image->nbLignes; ligne++){
+        for(int colonne = 0; colonne < image->nbColonnes; colonne++){
+            ligneSource = echange ? colonne : ligne;
+            colonneSource = echange ? ligne : colonne;
+            if(symetrie & 1){
+                ligneSource = source->nbLignes - 1 - ligneSource;
+            }
+            if(symetrie & 2){
+                colonneSource = source->nbColonnes - 1 - colonneSource;
+            }
+            image->cases[ligne][colonne] =
+                source->cases[ligneSource][colonneSource];
+        }
+    }
+}
+
+/**
+*
+* @brief Ordonner deux formes (dimensions, puis cases ligne par ligne)
+* @param formeA de type t_forme*, Entrée : première forme
+* @param formeB de type t_forme*, Entrée : seconde forme
+* @return entier : négatif, nul ou positif si formeA est plus petite,
+*   égale ou plus grande que formeB
+*/
+int comparer_formes(t_forme *formeA, t_forme *formeB)
+{
+    int ordre;
+
+    if(formeA->nbLignes != formeB->nbLignes){
+        ordre = formeA->nbLignes - formeB->nbLignes;
+    }
+    else if(formeA->nbColonnes != formeB->nbColonnes){
+        ordre = formeA->nbColonnes - formeB->nbColonnes;
+    }
+    else{
+        ordre = memcmp(formeA->cases, formeB->cases, sizeof(t_plateau));
+    }
+
+    return ordre;
+}
+
+/**
+*
+* @brief Calculer la forme canonique d'un niveau : recadré, puis la plus
+*   petite de ses 8 images
+* @param plateau de type t_plateau, Entrée : niveau chargé
+* @param forme de type t_forme*, Sortie : forme canonique
+*/
+void canoniser_plateau(t_plateau plateau, t_forme *forme)
+{
+    t_forme recadree;
+    t_forme image;
+
+    recadrer_plateau(plateau, &recadree);
+    *forme = recadree;
+
+    for(int symetrie = 1; symetrie < NB_SYMETRIES; symetrie++){
+        appliquer_symetrie(&recadree, symetrie, &image);
+        if(comparer_formes(&image, forme) < 0){
+            *forme = image;
+        }
+    }
+}
+
+/**
+*
+* @brief Calculer l'empreinte d'une forme (FNV-1a 64 bits sur les
+*   dimensions et les cases utiles)
+* @param forme de type t_forme*, Entrée : forme canonique
+* @return entier 64 bits : empreinte
+*/
+uint64_t hacher_forme(t_forme *forme)
+{
+    uint64_t empreinte = FNV_BASE;
+
+    empreinte = (empreinte ^ (uint64_t)forme->nbLignes) * FNV_PREMIER;
+    empreinte = (empreinte ^ (uint64_t)forme->nbColonnes) * FNV_PREMIER;
+
+    for(int ligne = 0; ligne < forme->nbLignes; ligne++){
+        for(int colonne = 0; colonne < forme->nbColonnes; colonne++){
+            empreinte ^= (unsigned char)forme->cases[ligne][colonne];
+            empreinte *= FNV_PREMIER;
+        }
+    }
+
+    return empreinte;
+}
+
+/**
+*
+* @brief Tester si deux formes sont identiques
+* @param formeA de type t_forme*, Entrée : première forme
+* @param formeB de type t_forme*, Entrée : seconde forme
+* @return booléen : true si les formes sont identiques
+*/
+bool formes_egales(t_forme *formeA, t_forme *formeB)
+{
+    return comparer_formes(formeA, formeB) == 0;
+}
+
+/**
+*
+* @brief Traduire une case du plateau d'origine en case de la forme
+* @param forme de type t_forme*, Entrée : forme calculée sur ce plateau
+* @param ligne de type entier*, Entrée/Sortie : ligne de la case
+* @param colonne de type entier*, Entrée/Sortie : colonne de la case
+*/
+void case_vers_forme(t_forme *forme, int *ligne, int *colonne)
+{
+    bool echange = (forme->symetrie & 4) != 0;
+    int nbLignes = echange ? forme->nbColonnes : forme->nbLignes;
+    int nbColonnes = echange ? forme->nbLignes : forme->nbColonnes;
+    int ligneSource = *ligne - forme->ligneOrigine;
+    int colonneSource = *colonne - forme->colonneOrigine;
+
+    if(forme->symetrie & 1){
+        ligneSource = nbLignes - 1 - ligneSource;
+    }
+    if(forme->symetrie & 2){
+        colonneSource = nbColonnes - 1 - colonneSource;
+    }
+    *ligne = echange ? colonneSource : ligneSource;
+    *colonne = echange ? ligneSource : colonneSource;
+}
+
+/**
+*
+* @brief Traduire une case de la forme en case du plateau d'origine
+* @param forme de type t_forme*, Entrée : forme calculée sur ce plateau
+* @param ligne de type entier*, Entrée/Sortie : ligne de la case
+* @param colonne de type entier*, Entrée/Sortie : colonne de la case
+*/
+void case_vers_plateau(t_forme *forme, int *ligne, int *colonne)
+{
+    bool echange = (forme->symetrie & 4) != 0;
+    int nbLignes = echange ? forme->nbColonnes : forme->nbLignes;
+    int nbColonnes = echange ? forme->nbLignes : forme->nbColonnes;
+    int ligneSource = echange ? *colonne : *ligne;
+    int colonneSource = echange ? *ligne : *colonne;
+
+    if(forme->symetrie & 1){
+        ligneSource = nbLignes - 1 - ligneSource;
+    }
+    if(forme->symetrie & 2){
+        colonneSource = nbColonnes - 1 - colonneSource;
+    }
+    *ligne = ligneSource + forme->ligneOrigine;
+    *colonne = colonneSource + forme->colonneOrigine;
+}
@@ -0,0 +1,45 @@
+/**
+* @file canonique.h
+* @brief Forme canonique d'un niveau, pour repérer les doublons
+* @author Liam CHARPENTIER
+* @version 2
+* @date 19/10/2026
+*
+* Les marges vides du plateau sont retirées (lignes et colonnes ne
+* contenant que des cases VIDE), puis la plus petite des 8 images du
+* niveau par rotation et symétrie est gardée. Deux niveaux qui ne
+* diffèrent que par un décalage, une rotation ou un retournement ont donc
+* la même forme et la même empreinte.
+*
+* La forme garde aussi le passage du plateau d'origine à elle (recadrage
+* et symétrie), pour y traduire des cases.
+*/
+
+#ifndef CANONIQUE_H
+#define CANONIQUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sokoban.h"
+
+#define NB_SYMETRIES 8
+
+// Niveau recadré, placé en haut à gauche (le reste est VIDE)
+typedef struct {
+    int nbLignes;
+    int nbColonnes;
+    t_plateau cases;
+    // passage du plateau d'origine à la forme (ignoré par les comparaisons)
+    int ligneOrigine;
+    int colonneOrigine;
+    int symetrie;
+} t_forme;
+
+void canoniser_plateau(t_plateau plateau, t_forme *forme);
+uint64_t hacher_forme(t_forme *forme);
+bool formes_egales(t_forme *formeA, t_forme *formeB);
+void case_vers_forme(t_forme *forme, int *ligne, int *colonne);
+void case_vers_plateau(t_forme *forme, int *ligne, int *colonne);
+
+#endif
@@ -0,0 +1,95 @@
+/**
+* @file conseil.c
+* @brief Conseil de la prochaine poussée pendant une partie
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le plan gardé est indépendant de la case exacte du joueur : les états
+* comparés sont ceux du solveur (caisses et zone du joueur).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "conseil.h"
+
+/**
+*
+* @brief Oublier le plan gardé (nouveau niveau)
+* @param conseil de type t_conseil, Sortie : plan à vider
+*/
+void oublier_conseil(t_conseil *conseil)
+{
+    conseil->nbPoussees = 0;
+    conseil->resolu = false;
+}
+
+/**
+*
+* @brief Trouver un état parmi ceux du plan gardé
+* @param conseil de type t_conseil, Entrée : plan gardé
+* @param etat de type t_etat, Entrée : état courant
+* @return entier : numéro de la poussée à faire, -1 si l'état n'est pas
+*   dans le plan (ou s'il en est la fin)
+*/
+int etape_plan(t_conseil *conseil, t_etat *etat)
+{
+    int etape = -1;
+
+    for(int i = conseil->nbPoussees - 1 ; etape < 0 && i >= 0 ; i--){
+        if(etats_egaux(&conseil->etats[i], etat)){
+            etape = i;
+        }
+    }
+
+    return etape;
+}
+
+/**
+*
+* @brief Conseiller la prochaine poussée depuis un plateau
+* @param conseil de type t_conseil, Entrée/Sortie : plan gardé
+* @param plateau de type t_plateau, Entrée : plateau courant
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide)
+* @param cache de type t_cache, Entrée/Sortie : solutions déjà trouvées
+*   (NULL : aucun cache)
+* @param poussee de type t_poussee, Sortie : poussée conseillée
+* @return vrai si une poussée est conseillée
+*/
+bool conseiller_poussee(t_conseil *conseil, t_plateau plateau,
+    t_motifs *motifs, t_cache *cache, t_poussee *poussee)
+{
+    t_niveau niveau;
+    t_optionsSolveur options;
+    t_verdict verdict;
+    int etape = -1;
+
+    if(analyser_niveau(plateau, &niveau)){
+        etape = etape_plan(conseil, &niveau.depart);
+
+        if(etape < 0){
+            options_par_defaut(&options);
+            options.motifs = motifs->bits != NULL ? motifs : NULL;
+            options.delaiMs = DELAI_CONSEIL;
+            options.cache = cache;
+            conseil->nbPoussees = planifier_poussees(plateau, &options,
+                conseil->poussees, PLAN_CONSEIL_MAX, &verdict);
+            conseil->resolu = verdict == VERDICT_RESOLU;
+            if(conseil->nbPoussees < 0){
+                conseil->nbPoussees = 0;
+            }
+            calculer_etats(&niveau, conseil->poussees, conseil->nbPoussees,
+                conseil->etats);
+            etape = conseil->nbPoussees > 0 ? 0 : -1;
+        }
+    }
+
+    if(etape >= 0){
+        *poussee = conseil->poussees[etape];
+    }
+
+    return etape >= 0;
+}
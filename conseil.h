@@ -0,0 +1,42 @@
+/**
+* @file conseil.h
+* @brief Conseil de la prochaine poussée pendant une partie
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le solveur cherche pendant DELAI_CONSEIL millisecondes au plus et rend
+* la meilleure piste trouvée : la solution si elle est trouvée à temps,
+* sinon le chemin vers l'état le plus proche d'une solution. Ce plan est
+* gardé : tant que le joueur le suit (ou revient sur un de ses états), le
+* conseil suivant est donné sans nouvelle recherche. Une position dont la
+* solution est dans le cache (voir cache.h) est conseillée sans recherche.
+*/
+
+#ifndef CONSEIL_H
+#define CONSEIL_H
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "motifs.h"
+#include "cache.h"
+
+#define DELAI_CONSEIL       200 // millisecondes
+#define PLAN_CONSEIL_MAX    128 // poussées gardées
+
+// Plan gardé entre deux demandes de conseil
+typedef struct {
+    t_etat etats[PLAN_CONSEIL_MAX + 1]; // état avant chaque poussée
+    t_poussee poussees[PLAN_CONSEIL_MAX];
+    int nbPoussees; // 0 : aucun plan
+    bool resolu; // le plan mène à la solution
+} t_conseil;
+
+void oublier_conseil(t_conseil *conseil);
+int etape_plan(t_conseil *conseil, t_etat *etat);
+bool conseiller_poussee(t_conseil *conseil, t_plateau plateau,
+    t_motifs *motifs, t_cache *cache, t_poussee *poussee);
+
+#endif
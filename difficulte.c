@@ -0,0 +1,258 @@
+/**
+* @file difficulte.c
+* @brief Estimation de la difficulté d'un niveau, sans joueur humain
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Les niveaux d'une collection sont notés en parallèle (un niveau par
+* thread à la fois), puis écrits du plus facile au plus difficile.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "optimiseur.h"
+#include "difficulte.h"
+
+// Part du travail d'un thread : les fichiers premier, premier + pas, ...
+typedef struct {
+    char **fichiers;
+    int nbFichiers;
+    int premier;
+    int pas;
+    t_motifs *motifs;
+    t_difficulte *difficultes;
+} t_lotDifficulte;
+
+// Note d'un fichier, triée pour écrire la collection dans l'ordre
+typedef struct {
+    double note;
+    int indice;
+} t_classement;
+
+/* Fonctions internes */
+
+void mesurer_structure(t_plateau plateau, t_difficulte *difficulte);
+double noter_difficulte(t_difficulte *difficulte);
+void *estimer_lot(void *argument);
+int ordonner_classement(const void *classementA, const void *classementB);
+
+/**
+*
+* @brief Relever la structure du niveau : caisses, cases atteignables,
+*   cases mortes et couloirs
+* @param plateau de type t_plateau, Entrée : niveau
+* @param difficulte de type t_difficulte, Entrée/Sortie : critères
+*/
+void mesurer_structure(t_plateau plateau, t_difficulte *difficulte)
+{
+    t_niveau niveau;
+    t_caisses aucune;
+    bool atteint[NB_CASES];
+
+    difficulte->lisible = analyser_niveau(plateau, &niveau);
+    if(difficulte->lisible){
+        // Les caisses n'arrêtent pas le joueur : toute la salle compte
+        memset(&aucune, 0, sizeof(t_caisses));
+        zone_joueur(&niveau, &aucune, niveau.joueurDepart, atteint);
+        difficulte->nbCaisses = niveau.nbCaisses;
+        for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+            if(atteint[numCase]){
+                difficulte->nbCases++;
+                difficulte->nbMortes += niveau.caseMorte[numCase];
+                difficulte->nbCouloirs += niveau.tunnel[numCase][0] ||
+                    niveau.tunnel[numCase][1];
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Calculer la note à partir des critères (voir difficulte.h)
+* @param difficulte de type t_difficulte, Entrée : critères
+* @return réel : note, plus elle est haute plus le niveau est difficile
+*/
+double noter_difficulte(t_difficulte *difficulte)
+{
+    double densiteMortes = difficulte->nbCases > 0 ?
+        (double)difficulte->nbMortes / difficulte->nbCases : 0;
+    double note = log2(1.0 + difficulte->noeudsExplores) +
+        POIDS_POUSSEES * difficulte->nbPoussees +
+        POIDS_BRANCHEMENT * difficulte->branchement +
+        POIDS_MORTES * densiteMortes +
+        POIDS_CAISSES * difficulte->nbCaisses;
+
+    return difficulte->resolu ? note : note + NOTE_NON_RESOLU;
+}
+
+/**
+*
+* @brief Résoudre un niveau et estimer sa difficulté
+* @param plateau de type t_plateau, Entrée : niveau
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL si absente)
+* @param difficulte de type t_difficulte, Sortie : critères et note
+*/
+void estimer_difficulte(t_plateau plateau, t_motifs *motifs,
+    t_difficulte *difficulte)
+{
+    char solution[TAILLE_SOLUTION_MAX];
+    t_statsSolveur stats;
+    t_optionsSolveur options;
+
+    memset(difficulte, 0, sizeof(t_difficulte));
+    mesurer_structure(plateau, difficulte);
+
+    if(difficulte->lisible){
+        options_par_defaut(&options);
+        options.motifs = motifs;
+        options.limiteNoeuds = DIFFICULTE_NOEUDS;
+        difficulte->resolu = resoudre_niveau_options(plateau, solution,
+            &stats, &options);
+        difficulte->noeudsExplores = stats.noeudsExplores;
+        difficulte->noeudsCrees = stats.noeudsCrees;
+        difficulte->nbPoussees = stats.nbPoussees;
+        difficulte->nbDeplacements = stats.nbDeplacements;
+        difficulte->branchement = stats.noeudsExplores > 0 ?
+            (double)stats.noeudsCrees / stats.noeudsExplores : 0;
+        difficulte->note = noter_difficulte(difficulte);
+    }
+}
+
+/**
+*
+* @brief Estimer la difficulté des fichiers d'un lot (fonction de thread)
+* @param argument de type t_lotDifficulte*, Entrée/Sortie : lot à traiter
+* @return pointeur : NULL
+*/
+void *estimer_lot(void *argument)
+{
+    t_lotDifficulte *lot = argument;
+    t_plateau plateau;
+
+    for(int i = lot->premier ; i < lot->nbFichiers ; i += lot->pas){
+        // charger_partie arrête le programme si le fichier n'existe pas
+        if(access(lot->fichiers[i], R_OK) == 0){
+            charger_partie(plateau, lot->fichiers[i]);
+            estimer_difficulte(plateau, lot->motifs, &lot->difficultes[i]);
+        }
+        else{
+            memset(&lot->difficultes[i], 0, sizeof(t_difficulte));
+        }
+    }
+
+    return NULL;
+}
+
+/**
+*
+* @brief Estimer la difficulté de toute une collection, sur tous les coeurs
+* @param fichiers de type tableau de chaînes, Entrée : fichiers des niveaux
+* @param nbFichiers de type entier, Entrée : nombre de fichiers
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL si absente)
+* @param difficultes de type tableau de t_difficulte, Sortie : une par
+*   fichier
+* @return entier : nombre de threads utilisés
+*/
+int estimer_collection(char *fichiers[], int nbFichiers, t_motifs *motifs,
+    t_difficulte difficultes[])
+{
+    pthread_t threads[THREADS_MAX];
+    t_lotDifficulte lots[THREADS_MAX];
+    int nbThreads = nombre_threads();
+
+    for(int i = 0 ; i < nbThreads ; i++){
+        lots[i] = (t_lotDifficulte){fichiers, nbFichiers, i, nbThreads,
+            motifs, difficultes};
+        pthread_create(&threads[i], NULL, estimer_lot, &lots[i]);
+    }
+    for(int i = 0 ; i < nbThreads ; i++){
+        pthread_join(threads[i], NULL);
+    }
+
+    return nbThreads;
+}
+
+/**
+*
+* @brief Comparer deux notes (fonction de qsort)
+* @param classementA de type t_classement*, Entrée : premier fichier
+* @param classementB de type t_classement*, Entrée : second fichier
+* @return entier : négatif si le premier est plus facile
+*/
+int ordonner_classement(const void *classementA, const void *classementB)
+{
+    const t_classement *premier = classementA;
+    const t_classement *second = classementB;
+    int ordre;
+
+    if(premier->note != second->note){
+        ordre = premier->note < second->note ? -1 : 1;
+    }
+    else{
+        ordre = premier->indice - second->indice;
+    }
+
+    return ordre;
+}
+
+/**
+*
+* @brief Écrire le fichier de métadonnées de la collection : une ligne par
+*   niveau (valeurs séparées par des tabulations), du plus facile au plus
+*   difficile, les fichiers illisibles à la fin
+* @param fichier de type chaîne de caractères, Entrée : fichier à écrire
+* @param fichiers de type tableau de chaînes, Entrée : fichiers des niveaux
+* @param difficultes de type tableau de t_difficulte, Entrée : critères
+* @param nbFichiers de type entier, Entrée : nombre de fichiers
+* @return vrai si le fichier a été écrit
+*/
+bool ecrire_difficultes(char fichier[], char *fichiers[],
+    t_difficulte difficultes[], int nbFichiers)
+{
+    t_classement *classement = malloc(sizeof(t_classement) * nbFichiers);
+    FILE *sortie = fopen(fichier, "w");
+    t_difficulte *niveau;
+
+    for(int i = 0 ; i < nbFichiers ; i++){
+        classement[i] = (t_classement){difficultes[i].lisible ?
+            difficultes[i].note : INFINITY, i};
+    }
+    qsort(classement, nbFichiers, sizeof(t_classement), ordonner_classement);
+
+    if(sortie != NULL){
+        fprintf(sortie, "# note\tfichier\tresolu\tpoussees\tdeplacements\t"
+            "noeuds\tbranchement\tcaisses\tcases\tmortes\tdensite_mortes\t"
+            "couloirs\n");
+        for(int i = 0 ; i < nbFichiers ; i++){
+            niveau = &difficultes[classement[i].indice];
+            if(niveau->lisible){
+                fprintf(sortie, "%.2f\t", niveau->note);
+            }
+            else{
+                fprintf(sortie, "-\t");
+            }
+            fprintf(sortie, "%s\t%s\t%d\t%d\t%ld\t%.2f\t%d\t%d\t%d\t%.2f\t%d"
+                "\n", fichiers[classement[i].indice], !niveau->lisible ?
+                "illisible" : niveau->resolu ? "oui" : "non",
+                niveau->nbPoussees, niveau->nbDeplacements,
+                niveau->noeudsExplores, niveau->branchement,
+                niveau->nbCaisses, niveau->nbCases, niveau->nbMortes,
+                niveau->nbCases > 0 ?
+                (double)niveau->nbMortes / niveau->nbCases : 0,
+                niveau->nbCouloirs);
+        }
+        fclose(sortie);
+    }
+    free(classement);
+
+    return sortie != NULL;
+}
@@ -0,0 +1,60 @@
+/**
+* @file difficulte.h
+* @brief Estimation de la difficulté d'un niveau, sans joueur humain
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Chaque niveau est résolu (sans cache, pour mesurer un vrai effort) et
+* décrit par :
+* - les statistiques du solveur : noeuds explorés, poussées et
+*   déplacements de la solution, facteur de branchement (noeuds créés par
+*   noeud exploré) ;
+* - sa structure : caisses, cases atteignables, cases mortes (une caisse
+*   n'y atteint plus aucune cible) et cases de couloir.
+*
+* La note additionne log2(1 + noeuds explorés), qui mesure l'effort de
+* recherche, et les autres critères pondérés (POIDS_...). Un niveau que
+* le solveur n'a pas résolu dans sa limite reçoit NOTE_NON_RESOLU en plus,
+* pour être classé après tous les autres.
+*/
+
+#ifndef DIFFICULTE_H
+#define DIFFICULTE_H
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+#include "motifs.h"
+
+#define DIFFICULTE_NOEUDS   500000  // limite du solveur par niveau
+#define POIDS_POUSSEES      0.2
+#define POIDS_BRANCHEMENT   1.0
+#define POIDS_MORTES        10.0    // densité de cases mortes (0 à 1)
+#define POIDS_CAISSES       0.5
+#define NOTE_NON_RESOLU     100.0
+
+// Critères et note d'un niveau
+typedef struct {
+    bool lisible; // faux si le fichier manque ou si le niveau est invalide
+    bool resolu;
+    long noeudsExplores;
+    long noeudsCrees;
+    int nbPoussees;
+    int nbDeplacements;
+    double branchement;
+    int nbCaisses;
+    int nbCases; // atteignables par le joueur, caisses ignorées
+    int nbMortes;
+    int nbCouloirs;
+    double note;
+} t_difficulte;
+
+void estimer_difficulte(t_plateau plateau, t_motifs *motifs,
+    t_difficulte *difficulte);
+int estimer_collection(char *fichiers[], int nbFichiers, t_motifs *motifs,
+    t_difficulte difficultes[]);
+bool ecrire_difficultes(char fichier[], char *fichiers[],
+    t_difficulte difficultes[], int nbFichiers);
+
+#endif
@@ -0,0 +1,632 @@
+/**
+* @file enregistrement.c
+* @brief Enregistrement d'une session de jeu complète, et son rejeu
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le tampon circulaire a deux compteurs qui ne font qu'augmenter : tete
+* (octets déposés par le jeu) et queue (octets écrits par le thread).
+* Chacun n'est avancé que par son propriétaire, après avoir copié les
+* octets (ordre release/acquire) : ni le jeu ni le thread ne prennent de
+* verrou.
+*
+* Le rejeu refait chaque changement d'état avec le moteur et le compare
+* au résultat enregistré : une différence signale une session qui ne se
+* rejoue pas à l'identique.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "enregistrement.h"
+
+#define ENREGISTREMENT_SIGNATURE    "SKSE"
+
+// Événement relu
+typedef struct {
+    t_typeEvenement type;
+    long instant; // microsecondes depuis le début de la session
+    unsigned long valeur;
+    char nom[ENREGISTREMENT_NOM_MAX + 1];
+    t_plateau plateau;
+    t_tabDeplacement codes;
+    int nbCodes;
+} t_evenementLu;
+
+// Partie rejouée et bilan du niveau en cours
+typedef struct {
+    t_moteur moteur;
+    t_plateau depart;
+    char nom[ENREGISTREMENT_NOM_MAX + 1];
+    bool charge; // un niveau a été chargé
+    long debutNiveau; // microsecondes
+    long dernierInstant;
+    int nbTouches;
+    int nbCoups;
+    int nbAnnulations;
+    int nbRecommencements;
+    t_typeEvenement fin; // EVENEMENT_VICTOIRE, EVENEMENT_ABANDON ou
+                         // EVENEMENT_FIN (niveau pas terminé)
+    // Toute la session
+    long nbEvenements;
+    int nbNiveaux;
+    int nbDifferences;
+    bool termine; // EVENEMENT_FIN lu
+    unsigned long perdus;
+} t_rejeu;
+
+// Directions dans l'ordre des événements : haut, bas, gauche, droite
+const int EVENEMENT_DEP_X[4] = {-1, 1, 0, 0};
+const int EVENEMENT_DEP_Y[4] = {0, 0, -1, 1};
+
+/* Fonctions internes */
+
+long horloge_enregistrement(void);
+int coder_varint(unsigned char octets[], unsigned long valeur);
+int coder_entete(t_enregistrement *enregistrement, unsigned char octets[],
+    t_typeEvenement type, long *maintenant);
+void deposer_evenement(t_enregistrement *enregistrement,
+    const unsigned char octets[], int taille, long maintenant);
+void vider_enregistrement(t_enregistrement *enregistrement);
+void *ecrire_enregistrement(void *argument);
+bool lire_varint(FILE *fichier, unsigned long *valeur);
+bool lire_niveau(FILE *fichier, t_evenementLu *evenement);
+bool lire_evenement(FILE *fichier, t_evenementLu *evenement);
+void commencer_rejeu_niveau(t_rejeu *rejeu, t_evenementLu *evenement);
+bool rejouer_coup(t_rejeu *rejeu, t_evenementLu *evenement);
+bool rejouer_fin(t_rejeu *rejeu, t_evenementLu *evenement);
+void appliquer_evenement(t_rejeu *rejeu, t_evenementLu *evenement);
+void afficher_bilan_niveau(t_rejeu *rejeu);
+
+/**
+*
+* @brief Lire l'horloge monotone
+* @return entier long : temps en microsecondes
+*/
+long horloge_enregistrement(void)
+{
+    struct timespec temps;
+
+    clock_gettime(CLOCK_MONOTONIC, &temps);
+
+    return temps.tv_sec * 1000000L + temps.tv_nsec / 1000;
+}
+
+/**
+*
+* @brief Coder un entier par 7 bits, poids faibles d'abord
+* @param octets de type tableau d'octets, Sortie : 10 octets au plus
+* @param valeur de type entier long non signé, Entrée : valeur
+* @return entier : nombre d'octets écrits
+*/
+int coder_varint(unsigned char octets[], unsigned long valeur)
+{
+    int taille = 0;
+
+    while(valeur >= 0x80){
+        octets[taille++] = (valeur & 0x7F) | 0x80;
+        valeur >>= 7;
+    }
+    octets[taille++] = valeur;
+
+    return taille;
+}
+
+/**
+*
+* @brief Coder le type d'un événement et le temps écoulé depuis le
+*   précédent
+* @param enregistrement de type t_enregistrement, Entrée : enregistrement
+* @param octets de type tableau d'octets, Sortie : début de l'événement
+* @param type de type t_typeEvenement, Entrée : type de l'événement
+* @param maintenant de type entier long*, Sortie : instant de l'événement
+* @return entier : nombre d'octets écrits
+*/
+int coder_entete(t_enregistrement *enregistrement, unsigned char octets[],
+    t_typeEvenement type, long *maintenant)
+{
+    *maintenant = horloge_enregistrement();
+    octets[0] = type;
+
+    return 1 + coder_varint(&octets[1],
+        *maintenant - enregistrement->dernierInstant);
+}
+
+/**
+*
+* @brief Déposer un événement dans le tampon (perdu s'il est plein)
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement
+* @param octets de type tableau d'octets, Entrée : événement codé
+* @param taille de type entier, Entrée : nombre d'octets
+* @param maintenant de type entier long, Entrée : instant de l'événement
+*/
+void deposer_evenement(t_enregistrement *enregistrement,
+    const unsigned char octets[], int taille, long maintenant)
+{
+    unsigned long tete = atomic_load_explicit(&enregistrement->tete,
+        memory_order_relaxed);
+    unsigned long queue = atomic_load_explicit(&enregistrement->queue,
+        memory_order_acquire);
+    unsigned long debut = tete & (ENREGISTREMENT_TAMPON - 1);
+    int avantFin = ENREGISTREMENT_TAMPON - debut;
+
+    if(tete - queue + taille > ENREGISTREMENT_TAMPON){
+        enregistrement->perdus++;
+    }
+    else{
+        // L'événement peut faire le tour du tampon
+        memcpy(&enregistrement->tampon[debut], octets,
+            taille < avantFin ? taille : avantFin);
+        if(taille > avantFin){
+            memcpy(enregistrement->tampon, &octets[avantFin],
+                taille - avantFin);
+        }
+        atomic_store_explicit(&enregistrement->tete, tete + taille,
+            memory_order_release);
+        // Le temps d'un événement perdu est compté dans le suivant
+        enregistrement->dernierInstant = maintenant;
+    }
+}
+
+/**
+*
+* @brief Écrire dans le fichier les octets déposés depuis la dernière
+*   écriture
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement
+*/
+void vider_enregistrement(t_enregistrement *enregistrement)
+{
+    unsigned long tete = atomic_load_explicit(&enregistrement->tete,
+        memory_order_acquire);
+    unsigned long queue = atomic_load_explicit(&enregistrement->queue,
+        memory_order_relaxed);
+    unsigned long debut = queue & (ENREGISTREMENT_TAMPON - 1);
+    unsigned long taille = tete - queue;
+    unsigned long avantFin = ENREGISTREMENT_TAMPON - debut;
+
+    if(taille > 0){
+        fwrite(&enregistrement->tampon[debut], 1,
+            taille < avantFin ? taille : avantFin, enregistrement->fichier);
+        if(taille > avantFin){
+            fwrite(enregistrement->tampon, 1, taille - avantFin,
+                enregistrement->fichier);
+        }
+        fflush(enregistrement->fichier);
+        atomic_store_explicit(&enregistrement->queue, tete,
+            memory_order_release);
+    }
+}
+
+/**
+*
+* @brief Vider le tampon régulièrement jusqu'à l'arrêt (fonction de
+*   thread)
+* @param argument de type t_enregistrement*, Entrée/Sortie :
+*   enregistrement
+* @return pointeur : NULL
+*/
+void *ecrire_enregistrement(void *argument)
+{
+    t_enregistrement *enregistrement = argument;
+    struct timespec periode = {0, ENREGISTREMENT_PERIODE * 1000000L};
+
+    while(!atomic_load(&enregistrement->arret)){
+        vider_enregistrement(enregistrement);
+        nanosleep(&periode, NULL);
+    }
+    vider_enregistrement(enregistrement);
+
+    return NULL;
+}
+
+/**
+*
+* @brief Commencer l'enregistrement de la session
+* @param fichier de type chaîne de caractères, Entrée : fichier à écrire
+*   (NULL : pas d'enregistrement)
+* @return pointeur : enregistrement, NULL s'il est désactivé ou si le
+*   fichier ne peut pas être créé
+*/
+t_enregistrement *lancer_enregistrement(char fichier[])
+{
+    unsigned char entete[ENREGISTREMENT_TAILLE_ENTETE] =
+        ENREGISTREMENT_SIGNATURE;
+    t_enregistrement *enregistrement = NULL;
+    FILE *sortie = fichier != NULL ? fopen(fichier, "wb") : NULL;
+    long date = time(NULL);
+
+    if(sortie != NULL){
+        entete[4] = ENREGISTREMENT_VERSION;
+        for(int i = 0 ; i < 8 ; i++){
+            entete[8 + i] = (date >> (8 * i)) & 0xFF;
+        }
+        fwrite(entete, 1, ENREGISTREMENT_TAILLE_ENTETE, sortie);
+
+        enregistrement = calloc(1, sizeof(t_enregistrement));
+        enregistrement->fichier = sortie;
+        enregistrement->tampon = malloc(ENREGISTREMENT_TAMPON);
+        atomic_init(&enregistrement->tete, 0);
+        atomic_init(&enregistrement->queue, 0);
+        atomic_init(&enregistrement->arret, false);
+        enregistrement->dernierInstant = horloge_enregistrement();
+        pthread_create(&enregistrement->thread, NULL, ecrire_enregistrement,
+            enregistrement);
+    }
+
+    return enregistrement;
+}
+
+/**
+*
+* @brief Noter un événement à une valeur (tous sauf EVENEMENT_NIVEAU)
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement (NULL : désactivé)
+* @param type de type t_typeEvenement, Entrée : type de l'événement
+* @param valeur de type entier long non signé, Entrée : donnée de
+*   l'événement (voir t_typeEvenement)
+*/
+void noter_evenement(t_enregistrement *enregistrement, t_typeEvenement type,
+    unsigned long valeur)
+{
+    unsigned char octets[1 + 10 + 10];
+    long maintenant;
+    int taille;
+
+    if(enregistrement != NULL){
+        taille = coder_entete(enregistrement, octets, type, &maintenant);
+        taille += coder_varint(&octets[taille], valeur);
+        deposer_evenement(enregistrement, octets, taille, maintenant);
+    }
+}
+
+/**
+*
+* @brief Noter un déplacement et son résultat
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement (NULL : désactivé)
+* @param depX de type entier, Entrée : sens vertical
+* @param depY de type entier, Entrée : sens horizontal
+* @param resultat de type t_resultatDeplacement, Entrée : résultat
+*/
+void noter_deplacement(t_enregistrement *enregistrement, int depX, int depY,
+    t_resultatDeplacement resultat)
+{
+    int direction;
+
+    if(depX != 0){
+        direction = depX < 0 ? 0 : 1;
+    }
+    else{
+        direction = depY < 0 ? 2 : 3;
+    }
+    noter_evenement(enregistrement, EVENEMENT_DEPLACEMENT,
+        direction * 4 + resultat);
+}
+
+/**
+*
+* @brief Noter le chargement d'un niveau
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement (NULL : désactivé)
+* @param nom de type chaîne de caractères, Entrée : fichier du niveau
+* @param plateau de type t_plateau, Entrée : niveau au départ
+* @param codes de type tableau de caractères, Entrée : déplacements
+*   joués avant la première touche (reprise d'un fichier .dep)
+* @param nbCodes de type entier, Entrée : nombre de déplacements repris
+*/
+void noter_niveau(t_enregistrement *enregistrement, const char nom[],
+    t_plateau plateau, const char codes[], int nbCodes)
+{
+    unsigned char octets[ENREGISTREMENT_EVENEMENT_MAX];
+    int longueur = strlen(nom);
+    long maintenant;
+    int taille;
+
+    if(enregistrement != NULL){
+        longueur = longueur < ENREGISTREMENT_NOM_MAX ? longueur :
+            ENREGISTREMENT_NOM_MAX;
+        taille = coder_entete(enregistrement, octets, EVENEMENT_NIVEAU,
+            &maintenant);
+        octets[taille++] = longueur;
+        memcpy(&octets[taille], nom, longueur);
+        taille += longueur;
+        memcpy(&octets[taille], plateau, TAILLE * TAILLE);
+        taille += TAILLE * TAILLE;
+        taille += coder_varint(&octets[taille], nbCodes);
+        memcpy(&octets[taille], codes, nbCodes);
+        deposer_evenement(enregistrement, octets, taille + nbCodes,
+            maintenant);
+    }
+}
+
+/**
+*
+* @brief Arrêter l'enregistrement : tout est écrit, avec le nombre
+*   d'événements perdus, et le fichier fermé
+* @param enregistrement de type t_enregistrement, Entrée/Sortie :
+*   enregistrement (NULL : désactivé), libéré
+*/
+void arreter_enregistrement(t_enregistrement *enregistrement)
+{
+    if(enregistrement != NULL){
+        atomic_store(&enregistrement->arret, true);
+        pthread_join(enregistrement->thread, NULL);
+        // Le thread a tout écrit : il y a la place pour la fin
+        noter_evenement(enregistrement, EVENEMENT_FIN,
+            enregistrement->perdus);
+        vider_enregistrement(enregistrement);
+        fclose(enregistrement->fichier);
+        free(enregistrement->tampon);
+        free(enregistrement);
+    }
+}
+
+/**
+*
+* @brief Lire un entier codé par 7 bits
+* @param fichier de type FILE*, Entrée : session
+* @param valeur de type entier long non signé*, Sortie : valeur
+* @return vrai si l'entier est complet
+*/
+bool lire_varint(FILE *fichier, unsigned long *valeur)
+{
+    int octet = 0x80;
+    int decalage = 0;
+
+    *valeur = 0;
+    while((octet & 0x80) && decalage < 64 &&
+        (octet = fgetc(fichier)) != EOF){
+        *valeur |= (unsigned long)(octet & 0x7F) << decalage;
+        decalage += 7;
+    }
+
+    return octet != EOF && !(octet & 0x80);
+}
+
+/**
+*
+* @brief Lire les données d'un chargement de niveau
+* @param fichier de type FILE*, Entrée : session
+* @param evenement de type t_evenementLu, Sortie : nom, plateau et
+*   déplacements repris
+* @return vrai si les données sont complètes
+*/
+bool lire_niveau(FILE *fichier, t_evenementLu *evenement)
+{
+    int longueur = fgetc(fichier);
+    unsigned long nbCodes = 0;
+    bool lu = longueur != EOF &&
+        (int)fread(evenement->nom, 1, longueur, fichier) == longueur &&
+        fread(evenement->plateau, 1, TAILLE * TAILLE, fichier) ==
+        TAILLE * TAILLE &&
+        lire_varint(fichier, &nbCodes) && nbCodes <= MAX_DEP &&
+        fread(evenement->codes, 1, nbCodes, fichier) == nbCodes;
+
+    evenement->nom[lu ? longueur : 0] = '\0';
+    evenement->nbCodes = lu ? nbCodes : 0;
+
+    return lu;
+}
+
+/**
+*
+* @brief Lire l'événement suivant de la session
+* @param fichier de type FILE*, Entrée : session
+* @param evenement de type t_evenementLu, Entrée/Sortie : événement
+*   précédent (pour son instant), puis événement lu
+* @return vrai si un événement complet a été lu
+*/
+bool lire_evenement(FILE *fichier, t_evenementLu *evenement)
+{
+    int type = fgetc(fichier);
+    unsigned long ecoule;
+    bool lu = type != EOF && type < NB_TYPES_EVENEMENT &&
+        lire_varint(fichier, &ecoule);
+
+    if(lu){
+        evenement->type = type;
+        evenement->instant += ecoule;
+        if(type == EVENEMENT_NIVEAU){
+            lu = lire_niveau(fichier, evenement);
+        }
+        else{
+            lu = lire_varint(fichier, &evenement->valeur);
+        }
+    }
+
+    return lu;
+}
+
+/**
+*
+* @brief Charger le niveau d'un événement et commencer son bilan
+* @param rejeu de type t_rejeu, Entrée/Sortie : rejeu
+* @param evenement de type t_evenementLu, Entrée : chargement du niveau
+*/
+void commencer_rejeu_niveau(t_rejeu *rejeu, t_evenementLu *evenement)
+{
+    if(rejeu->charge){
+        afficher_bilan_niveau(rejeu);
+    }
+
+    strcpy(rejeu->nom, evenement->nom);
+    memcpy(rejeu->depart, evenement->plateau, sizeof(t_plateau));
+    memcpy(rejeu->moteur.plateau, evenement->plateau, sizeof(t_plateau));
+    demarrer_niveau(&rejeu->moteur);
+    jouer_deplacements(&rejeu->moteur, evenement->codes, evenement->nbCodes);
+
+    rejeu->charge = true;
+    rejeu->debutNiveau = evenement->instant;
+    rejeu->nbTouches = 0;
+    rejeu->nbCoups = 0;
+    rejeu->nbAnnulations = 0;
+    rejeu->nbRecommencements = 0;
+    rejeu->fin = EVENEMENT_FIN;
+    rejeu->nbNiveaux++;
+}
+
+/**
+*
+* @brief Rejouer un déplacement, une annulation, un couloir ou un
+*   recommencement
+* @param rejeu de type t_rejeu, Entrée/Sortie : rejeu
+* @param evenement de type t_evenementLu, Entrée : événement
+* @return vrai si le résultat est celui enregistré
+*/
+bool rejouer_coup(t_rejeu *rejeu, t_evenementLu *evenement)
+{
+    t_moteur *moteur = &rejeu->moteur;
+    int direction = evenement->valeur / 4 % 4;
+    unsigned long resultat = 0;
+
+    if(evenement->type == EVENEMENT_DEPLACEMENT){
+        resultat = direction * 4 + deplacer(moteur,
+            EVENEMENT_DEP_X[direction], EVENEMENT_DEP_Y[direction]);
+        rejeu->nbCoups++;
+    }
+    else if(evenement->type == EVENEMENT_ANNULATION){
+        resultat = retour_arriere(moteur);
+        rejeu->nbAnnulations++;
+    }
+    else if(evenement->type == EVENEMENT_COULOIR){
+        resultat = traverser_couloir(moteur);
+    }
+    else{
+        memcpy(moteur->plateau, rejeu->depart, sizeof(t_plateau));
+        demarrer_niveau(moteur);
+        rejeu->nbRecommencements++;
+    }
+
+    return resultat == evenement->valeur;
+}
+
+/**
+*
+* @brief Vérifier la fin d'un niveau (victoire ou abandon)
+* @param rejeu de type t_rejeu, Entrée/Sortie : rejeu
+* @param evenement de type t_evenementLu, Entrée : événement
+* @return vrai si la partie rejouée finit comme celle enregistrée
+*/
+bool rejouer_fin(t_rejeu *rejeu, t_evenementLu *evenement)
+{
+    t_moteur *moteur = &rejeu->moteur;
+
+    rejeu->fin = evenement->type;
+
+    return (unsigned long)moteur->deplacements.nbDeplacements ==
+        evenement->valeur &&
+        gagne(moteur) == (evenement->type == EVENEMENT_VICTOIRE);
+}
+
+/**
+*
+* @brief Rejouer un événement de la session
+* @param rejeu de type t_rejeu, Entrée/Sortie : rejeu
+* @param evenement de type t_evenementLu, Entrée : événement
+*/
+void appliquer_evenement(t_rejeu *rejeu, t_evenementLu *evenement)
+{
+    t_typeEvenement type = evenement->type;
+    bool identique = true;
+
+    rejeu->nbEvenements++;
+    if(type == EVENEMENT_NIVEAU){
+        commencer_rejeu_niveau(rejeu, evenement);
+    }
+    else if(type == EVENEMENT_TOUCHE){
+        rejeu->nbTouches++;
+    }
+    else if(type == EVENEMENT_FIN){
+        rejeu->termine = true;
+        rejeu->perdus = evenement->valeur;
+    }
+    // Un changement d'état avant tout niveau ne peut pas être rejoué
+    else if(type != EVENEMENT_ZOOM){
+        identique = rejeu->charge;
+    }
+
+    if(rejeu->charge && (type == EVENEMENT_VICTOIRE ||
+        type == EVENEMENT_ABANDON)){
+        identique = rejouer_fin(rejeu, evenement);
+    }
+    else if(rejeu->charge && type >= EVENEMENT_DEPLACEMENT &&
+        type <= EVENEMENT_RECOMMENCER){
+        identique = rejouer_coup(rejeu, evenement);
+    }
+
+    rejeu->nbDifferences += !identique;
+    rejeu->dernierInstant = evenement->instant;
+}
+
+/**
+*
+* @brief Afficher le bilan du niveau rejoué
+* @param rejeu de type t_rejeu, Entrée : rejeu
+*/
+void afficher_bilan_niveau(t_rejeu *rejeu)
+{
+    printf("%s : %d touche(s), %d déplacement(s), %d annulation(s), "
+        "%d recommencement(s), %.1f s, %s\n", rejeu->nom, rejeu->nbTouches,
+        rejeu->nbCoups, rejeu->nbAnnulations, rejeu->nbRecommencements,
+        (rejeu->dernierInstant - rejeu->debutNiveau) / 1e6,
+        rejeu->fin == EVENEMENT_VICTOIRE ? "gagné" :
+        rejeu->fin == EVENEMENT_ABANDON ? "abandonné" : "pas terminé");
+}
+
+/**
+*
+* @brief Rejouer une session enregistrée sans affichage et afficher le
+*   bilan de chaque niveau
+* @param fichier de type chaîne de caractères, Entrée : session
+* @return entier : code de sortie (EXIT_FAILURE : fichier illisible ou
+*   rejeu différent de la session)
+*/
+int rejouer_session(char fichier[])
+{
+    unsigned char entete[ENREGISTREMENT_TAILLE_ENTETE];
+    t_evenementLu evenement;
+    t_rejeu rejeu;
+    FILE *entree = fopen(fichier, "rb");
+    bool valide = entree != NULL && fread(entete, 1,
+        ENREGISTREMENT_TAILLE_ENTETE, entree) == ENREGISTREMENT_TAILLE_ENTETE
+        && memcmp(entete, ENREGISTREMENT_SIGNATURE, 4) == 0 &&
+        entete[4] == ENREGISTREMENT_VERSION;
+    time_t date = 0;
+
+    memset(&evenement, 0, sizeof(t_evenementLu));
+    memset(&rejeu, 0, sizeof(t_rejeu));
+    if(valide){
+        for(int i = 7 ; i >= 0 ; i--){
+            date = (date << 8) | entete[8 + i];
+        }
+        printf("Session du %s", ctime(&date));
+        while(lire_evenement(entree, &evenement)){
+            appliquer_evenement(&rejeu, &evenement);
+        }
+        if(rejeu.charge){
+            afficher_bilan_niveau(&rejeu);
+        }
+        printf("%ld événement(s), %d niveau(x), %lu perdu(s)%s : %d "
+            "différence(s) au rejeu\n", rejeu.nbEvenements, rejeu.nbNiveaux,
+            rejeu.perdus, rejeu.termine ? "" : ", session interrompue",
+            rejeu.nbDifferences);
+    }
+    else{
+        printf("Impossible de lire la session %s\n", fichier);
+    }
+    if(entree != NULL){
+        fclose(entree);
+    }
+
+    return valide && rejeu.nbDifferences == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
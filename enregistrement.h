@@ -0,0 +1,88 @@
+/**
+* @file enregistrement.h
+* @brief Enregistrement d'une session de jeu complète, et son rejeu
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Activé par l'option --enregistrer du jeu, par exemple :
+*   ./bin/jeu --enregistrer session.skr
+* puis rejoué sans affichage avec ./bin/jeu --rejouer session.skr.
+*
+* Chaque touche lue et chaque changement d'état (déplacement, annulation,
+* recommencement, zoom, niveau chargé, victoire, abandon) est codé dans un
+* tampon circulaire en mémoire, sans verrou : le jeu est le seul à y
+* écrire et un thread est le seul à le vider dans le fichier, toutes les
+* ENREGISTREMENT_PERIODE ms. Le jeu n'attend donc jamais le disque ; si le
+* tampon est plein, l'événement est perdu et compté. Désactivé,
+* l'enregistrement ne coûte qu'un test par événement.
+*
+* Format : "SKSE", version, 3 octets nuls, date du début en secondes (8
+* octets, petit-boutiste), puis chaque événement : type (1 octet),
+* microsecondes depuis l'événement précédent, et ses données (voir
+* t_typeEvenement). Les entiers des événements sont écrits par 7 bits,
+* poids faibles d'abord, le bit de poids fort indiquant qu'un octet suit.
+* Un niveau chargé contient tout son plateau : le rejeu ne dépend pas des
+* fichiers .sok.
+*/
+
+#ifndef ENREGISTREMENT_H
+#define ENREGISTREMENT_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+
+#define ENREGISTREMENT_VERSION      1
+#define ENREGISTREMENT_TAILLE_ENTETE 16
+#define ENREGISTREMENT_TAMPON       (1 << 18) // octets, puissance de 2
+#define ENREGISTREMENT_PERIODE      100       // ms entre deux écritures
+#define ENREGISTREMENT_NOM_MAX      255       // nom de fichier d'un niveau
+// Le plus long événement : un niveau avec ses déplacements repris
+#define ENREGISTREMENT_EVENEMENT_MAX \
+    (1 + 10 + 1 + ENREGISTREMENT_NOM_MAX + TAILLE * TAILLE + 10 + MAX_DEP)
+
+// Types d'événements et leurs données
+typedef enum {
+    EVENEMENT_FIN,          // entier : événements perdus (tampon plein)
+    EVENEMENT_TOUCHE,       // entier : touche lue
+    EVENEMENT_NIVEAU,       // longueur du nom (1 octet), nom, plateau,
+                            // entier : déplacements repris, leurs codes
+    EVENEMENT_DEPLACEMENT,  // entier : direction * 4 + t_resultatDeplacement
+    EVENEMENT_ANNULATION,   // entier : 1 si un déplacement a été annulé
+    EVENEMENT_COULOIR,      // entier : poussées jusqu'au bout du couloir
+    EVENEMENT_RECOMMENCER,  // entier : 0
+    EVENEMENT_ZOOM,         // entier : nouveau zoom
+    EVENEMENT_VICTOIRE,     // entier : déplacements de la partie gagnée
+    EVENEMENT_ABANDON,      // entier : déplacements de la partie abandonnée
+    NB_TYPES_EVENEMENT
+} t_typeEvenement;
+
+// Enregistrement en cours
+typedef struct {
+    pthread_t thread;
+    FILE *fichier;
+    unsigned char *tampon; // ENREGISTREMENT_TAMPON octets
+    atomic_ulong tete; // octets déposés (avancé par le jeu seulement)
+    atomic_ulong queue; // octets écrits (avancé par le thread seulement)
+    atomic_bool arret;
+    // Propre au jeu
+    long dernierInstant; // horloge (µs) du dernier événement
+    unsigned long perdus;
+} t_enregistrement;
+
+t_enregistrement *lancer_enregistrement(char fichier[]);
+void noter_evenement(t_enregistrement *enregistrement, t_typeEvenement type,
+    unsigned long valeur);
+void noter_deplacement(t_enregistrement *enregistrement, int depX, int depY,
+    t_resultatDeplacement resultat);
+void noter_niveau(t_enregistrement *enregistrement, const char nom[],
+    t_plateau plateau, const char codes[], int nbCodes);
+void arreter_enregistrement(t_enregistrement *enregistrement);
+int rejouer_session(char fichier[]);
+
+#endif
@@ -0,0 +1,57 @@
+/**
+* @file fichiers.c
+* @brief Lecture et écriture des fichiers de niveau et de déplacements
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Fonctions fournies, partagées par le jeu et les outils
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sokoban.h"
+
+/* Fonctions fournies */
+
+void charger_partie(t_plateau plateau, char fichier[]){
+    FILE * f;
+    char finDeLigne;
+
+    f = fopen(fichier, "r");
+    if (f==NULL){
+        printf("ERREUR SUR FICHIER");
+        exit(EXIT_FAILURE);
+    } else {
+        for (int ligne = 0 ; ligne < TAILLE ; ligne++){
+            for (int colonne = 0 ; colonne < TAILLE ; colonne++){
+                fread(&plateau[ligne][colonne], sizeof(char), 1, f);
+            }
+            fread(&finDeLigne, sizeof(char), 1, f);
+        }
+        fclose(f);
+    }
+}
+
+void enregistrer_partie(t_plateau plateau, char fichier[]){
+    FILE * f;
+    char finDeLigne = '\n';
+
+    f = fopen(fichier, "w");
+    for (int ligne=0 ; ligne<TAILLE ; ligne++){
+        for (int colonne=0 ; colonne<TAILLE ; colonne++){
+            fwrite(&plateau[ligne][colonne], sizeof(char), 1, f);
+        }
+        fwrite(&finDeLigne, sizeof(char), 1, f);
+    }
+    fclose(f);
+}
+
+void enregistrer_deplacements(t_tabDeplacement t, int nb, char fic[]){
+    FILE * f;
+
+    f = fopen(fic, "w");
+    fwrite(t,sizeof(char), nb, f);
+    fclose(f);
+}
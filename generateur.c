@@ -0,0 +1,371 @@
+/**
+* @file generateur.c
+* @brief Génération aléatoire de niveaux toujours résolubles
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le hasard vient d'un générateur splitmix64 propre à chaque niveau :
+* aucun état partagé entre les threads.
+*/
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "optimiseur.h"
+#include "generateur.h"
+
+// Décalage d'une case dans chaque direction (haut, bas, gauche, droite)
+const int DECALAGES_GENERATION[NB_DIRECTIONS] = {-TAILLE, TAILLE, -1, 1};
+
+// Niveau en cours de construction, case par case
+typedef struct {
+    bool sol[NB_CASES]; // case creusée
+    bool cible[NB_CASES];
+    bool caisse[NB_CASES];
+    int joueur;
+} t_brouillon;
+
+// Part du travail d'un thread : les niveaux premier, premier + pas, ...
+typedef struct {
+    t_niveauGenere *niveaux;
+    int nbNiveaux;
+    int premier;
+    int pas;
+    uint64_t graine;
+    t_motifs *motifs;
+    long essais;
+} t_lotGeneration;
+
+/* Fonctions internes */
+
+uint64_t tirer_hasard(uint64_t *etat);
+int tirer_entier(uint64_t *etat, int borne);
+bool creuser_case(t_brouillon *brouillon, int ligne, int colonne);
+int creuser_salle(t_brouillon *brouillon, uint64_t *hasard);
+int case_libre_au_hasard(t_brouillon *brouillon, uint64_t *hasard);
+void placer_caisses(t_brouillon *brouillon, uint64_t *hasard, int nbSols);
+void tirer_caisses(t_brouillon *brouillon, uint64_t *hasard);
+void ecrire_plateau(t_brouillon *brouillon, t_plateau plateau);
+bool noter_plateau(t_plateau plateau, t_motifs *motifs, int *nbPoussees,
+    int *nbDeplacements);
+void *generer_lot(void *argument);
+
+/**
+*
+* @brief Tirer 64 bits au hasard (splitmix64)
+* @param etat de type entier 64 bits, Entrée/Sortie : état du générateur
+* @return entier 64 bits : nombre tiré
+*/
+uint64_t tirer_hasard(uint64_t *etat)
+{
+    uint64_t nombre;
+
+    *etat += 0x9E3779B97F4A7C15ULL;
+    nombre = *etat;
+    nombre = (nombre ^ (nombre >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    nombre = (nombre ^ (nombre >> 27)) * 0x94D049BB133111EBULL;
+
+    return nombre ^ (nombre >> 31);
+}
+
+/**
+*
+* @brief Tirer un entier au hasard
+* @param etat de type entier 64 bits, Entrée/Sortie : état du générateur
+* @param borne de type entier, Entrée : nombre de valeurs possibles
+* @return entier : entre 0 et borne - 1
+*/
+int tirer_entier(uint64_t *etat, int borne)
+{
+    return (int)(tirer_hasard(etat) % (uint64_t)borne);
+}
+
+/**
+*
+* @brief Creuser une case (le bord du plateau reste toujours un mur)
+* @param brouillon de type t_brouillon, Entrée/Sortie : niveau en cours
+* @param ligne de type entier, Entrée : ligne de la case
+* @param colonne de type entier, Entrée : colonne de la case
+* @return vrai si la case n'était pas encore creusée
+*/
+bool creuser_case(t_brouillon *brouillon, int ligne, int colonne)
+{
+    bool nouvelle = ligne >= 1 && ligne <= TAILLE - 2 && colonne >= 1 &&
+        colonne <= TAILLE - 2 && !brouillon->sol[ligne * TAILLE + colonne];
+
+    if(nouvelle){
+        brouillon->sol[ligne * TAILLE + colonne] = true;
+    }
+
+    return nouvelle;
+}
+
+/**
+*
+* @brief Creuser une salle d'un seul tenant par une marche au hasard
+* @param brouillon de type t_brouillon, Sortie : niveau sans caisse
+* @param hasard de type entier 64 bits, Entrée/Sortie : générateur
+* @return entier : nombre de cases creusées
+* Creuser parfois un bloc 2x2 donne des pièces, sinon des couloirs
+*/
+int creuser_salle(t_brouillon *brouillon, uint64_t *hasard)
+{
+    int objectif = GENERATION_SOLS_MIN +
+        tirer_entier(hasard, GENERATION_SOLS_MAX - GENERATION_SOLS_MIN + 1);
+    int ligne = 1 + tirer_entier(hasard, TAILLE - 2);
+    int colonne = 1 + tirer_entier(hasard, TAILLE - 2);
+    int nbSols = 0;
+    int direction;
+
+    memset(brouillon, 0, sizeof(t_brouillon));
+    while(nbSols < objectif){
+        nbSols += creuser_case(brouillon, ligne, colonne);
+        if(tirer_entier(hasard, 3) == 0){
+            nbSols += creuser_case(brouillon, ligne + 1, colonne);
+            nbSols += creuser_case(brouillon, ligne, colonne + 1);
+            nbSols += creuser_case(brouillon, ligne + 1, colonne + 1);
+        }
+
+        // La marche reste à l'intérieur du bord
+        direction = tirer_entier(hasard, NB_DIRECTIONS);
+        ligne += DECALAGES_GENERATION[direction] / TAILLE;
+        colonne += DECALAGES_GENERATION[direction] % TAILLE;
+        ligne = ligne < 1 ? 1 : ligne > TAILLE - 2 ? TAILLE - 2 : ligne;
+        colonne = colonne < 1 ? 1 : colonne > TAILLE - 2 ? TAILLE - 2 :
+            colonne;
+    }
+
+    return nbSols;
+}
+
+/**
+*
+* @brief Choisir au hasard une case creusée, sans cible ni caisse
+* @param brouillon de type t_brouillon, Entrée : niveau en cours
+* @param hasard de type entier 64 bits, Entrée/Sortie : générateur
+* @return entier : numéro de la case
+*/
+int case_libre_au_hasard(t_brouillon *brouillon, uint64_t *hasard)
+{
+    int numCase = tirer_entier(hasard, NB_CASES);
+
+    while(!brouillon->sol[numCase] || brouillon->cible[numCase] ||
+        brouillon->caisse[numCase]){
+        numCase = tirer_entier(hasard, NB_CASES);
+    }
+
+    return numCase;
+}
+
+/**
+*
+* @brief Poser les caisses sur leurs cibles (position gagnée) et le joueur
+* @param brouillon de type t_brouillon, Entrée/Sortie : salle creusée
+* @param hasard de type entier 64 bits, Entrée/Sortie : générateur
+* @param nbSols de type entier, Entrée : nombre de cases creusées
+*/
+void placer_caisses(t_brouillon *brouillon, uint64_t *hasard, int nbSols)
+{
+    // Environ une caisse pour 8 cases
+    int nbMax = nbSols / 8 < GENERATION_CAISSES_MAX ? nbSols / 8 :
+        GENERATION_CAISSES_MAX;
+    int nbCaisses = GENERATION_CAISSES_MIN +
+        tirer_entier(hasard, nbMax - GENERATION_CAISSES_MIN + 1);
+    int numCase;
+
+    for(int i = 0 ; i < nbCaisses ; i++){
+        numCase = case_libre_au_hasard(brouillon, hasard);
+        brouillon->cible[numCase] = true;
+        brouillon->caisse[numCase] = true;
+    }
+    brouillon->joueur = case_libre_au_hasard(brouillon, hasard);
+}
+
+/**
+*
+* @brief Jouer la partie à l'envers : le joueur se promène et tire parfois
+*   la caisse qui est derrière lui
+* @param brouillon de type t_brouillon, Entrée/Sortie : position gagnée,
+*   puis position de départ du niveau
+* @param hasard de type entier 64 bits, Entrée/Sortie : générateur
+*/
+void tirer_caisses(t_brouillon *brouillon, uint64_t *hasard)
+{
+    int direction, suivante, derriere;
+
+    for(int pas = 0 ; pas < GENERATION_PAS_INVERSES ; pas++){
+        direction = tirer_entier(hasard, NB_DIRECTIONS);
+        suivante = brouillon->joueur + DECALAGES_GENERATION[direction];
+        derriere = brouillon->joueur - DECALAGES_GENERATION[direction];
+
+        // Le bord est un mur : suivante et derriere restent sur le plateau
+        if(brouillon->sol[suivante] && !brouillon->caisse[suivante]){
+            if(brouillon->caisse[derriere] && tirer_entier(hasard, 2) == 0){
+                brouillon->caisse[derriere] = false;
+                brouillon->caisse[brouillon->joueur] = true;
+            }
+            brouillon->joueur = suivante;
+        }
+    }
+}
+
+/**
+*
+* @brief Écrire le niveau au format des fichiers .sok (murs autour des
+*   cases creusées, vide ailleurs)
+* @param brouillon de type t_brouillon, Entrée : niveau construit
+* @param plateau de type t_plateau, Sortie : plateau
+*/
+void ecrire_plateau(t_brouillon *brouillon, t_plateau plateau)
+{
+    bool bordure;
+
+    for(int ligne = 0 ; ligne < TAILLE ; ligne++){
+        for(int colonne = 0 ; colonne < TAILLE ; colonne++){
+            // Un mur touche une case creusée, même en diagonale
+            bordure = false;
+            for(int numVoisin = 0 ; numVoisin < 9 ; numVoisin++){
+                int voisinLigne = ligne + numVoisin / 3 - 1;
+                int voisinColonne = colonne + numVoisin % 3 - 1;
+
+                bordure = bordure || (voisinLigne >= 0 &&
+                    voisinLigne < TAILLE && voisinColonne >= 0 &&
+                    voisinColonne < TAILLE &&
+                    brouillon->sol[voisinLigne * TAILLE + voisinColonne]);
+            }
+            plateau[ligne][colonne] = bordure ? MUR : VIDE;
+        }
+    }
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        if(brouillon->sol[numCase]){
+            plateau[numCase / TAILLE][numCase % TAILLE] =
+                brouillon->caisse[numCase] ?
+                (brouillon->cible[numCase] ? CAISSE_SUR_CIBLE : CAISSE) :
+                (brouillon->cible[numCase] ? CIBLE : VIDE);
+        }
+    }
+    plateau[brouillon->joueur / TAILLE][brouillon->joueur % TAILLE] =
+        brouillon->cible[brouillon->joueur] ? PLAYER_SUR_CIBLE : PLAYER;
+}
+
+/**
+*
+* @brief Noter un niveau par la solution du solveur
+* @param plateau de type t_plateau, Entrée : niveau
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL si absente)
+* @param nbPoussees de type entier, Sortie : poussées de la solution
+* @param nbDeplacements de type entier, Sortie : déplacements
+* @return vrai si le solveur a trouvé une solution dans sa limite
+*/
+bool noter_plateau(t_plateau plateau, t_motifs *motifs, int *nbPoussees,
+    int *nbDeplacements)
+{
+    char solution[TAILLE_SOLUTION_MAX];
+    t_statsSolveur stats;
+    t_optionsSolveur options;
+
+    options_par_defaut(&options);
+    options.motifs = motifs;
+    options.limiteNoeuds = GENERATION_NOEUDS;
+    resoudre_niveau_options(plateau, solution, &stats, &options);
+    *nbPoussees = stats.nbPoussees;
+    *nbDeplacements = stats.nbDeplacements;
+
+    return stats.trouve;
+}
+
+/**
+*
+* @brief Générer un niveau : la plus longue de plusieurs parties à
+*   l'envers, dans des salles refaites tant qu'elle est trop courte
+* @param graine de type entier 64 bits, Entrée : graine du niveau
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL si absente)
+* @param niveau de type t_niveauGenere, Sortie : niveau et sa note
+* @param essais de type entier long, Entrée/Sortie : compteur d'essais
+* @return vrai si le niveau est assez long
+*/
+bool generer_niveau(uint64_t graine, t_motifs *motifs,
+    t_niveauGenere *niveau, long *essais)
+{
+    t_brouillon salle, essai;
+    t_plateau plateau;
+    uint64_t hasard = graine;
+    int nbPoussees, nbDeplacements;
+
+    memset(niveau, 0, sizeof(t_niveauGenere));
+    for(int numSalle = 0 ; numSalle < GENERATION_SALLES_MAX &&
+        !niveau->reussi ; numSalle++){
+        placer_caisses(&salle, &hasard, creuser_salle(&salle, &hasard));
+        for(int i = 0 ; i < GENERATION_ESSAIS ; i++){
+            essai = salle;
+            tirer_caisses(&essai, &hasard);
+            ecrire_plateau(&essai, plateau);
+            (*essais)++;
+            if(noter_plateau(plateau, motifs, &nbPoussees, &nbDeplacements)
+                && nbPoussees > niveau->nbPoussees){
+                memcpy(niveau->plateau, plateau, sizeof(t_plateau));
+                niveau->nbPoussees = nbPoussees;
+                niveau->nbDeplacements = nbDeplacements;
+            }
+        }
+        niveau->reussi = niveau->nbPoussees >= GENERATION_POUSSEES_MIN;
+    }
+
+    return niveau->reussi;
+}
+
+/**
+*
+* @brief Générer les niveaux d'un lot (fonction de thread)
+* @param argument de type t_lotGeneration*, Entrée/Sortie : lot à traiter
+* @return pointeur : NULL
+*/
+void *generer_lot(void *argument)
+{
+    t_lotGeneration *lot = argument;
+    uint64_t graine;
+
+    for(int i = lot->premier ; i < lot->nbNiveaux ; i += lot->pas){
+        // Graine du niveau : ne dépend que de la graine générale et de i
+        graine = lot->graine ^ ((uint64_t)(i + 1) * 0xD1B54A32D192ED03ULL);
+        generer_niveau(tirer_hasard(&graine), lot->motifs, &lot->niveaux[i],
+            &lot->essais);
+    }
+
+    return NULL;
+}
+
+/**
+*
+* @brief Générer des niveaux sur tous les coeurs
+* @param niveaux de type tableau de t_niveauGenere, Sortie : niveaux
+* @param nbNiveaux de type entier, Entrée : nombre de niveaux
+* @param graine de type entier 64 bits, Entrée : graine générale
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL si absente)
+* @param stats de type t_statsGeneration, Sortie : essais et threads
+*/
+void generer_niveaux(t_niveauGenere niveaux[], int nbNiveaux,
+    uint64_t graine, t_motifs *motifs, t_statsGeneration *stats)
+{
+    pthread_t threads[THREADS_MAX];
+    t_lotGeneration lots[THREADS_MAX];
+
+    stats->nbThreads = nombre_threads();
+    stats->essais = 0;
+    for(int i = 0 ; i < stats->nbThreads ; i++){
+        lots[i] = (t_lotGeneration){niveaux, nbNiveaux, i, stats->nbThreads,
+            graine, motifs, 0};
+        pthread_create(&threads[i], NULL, generer_lot, &lots[i]);
+    }
+    for(int i = 0 ; i < stats->nbThreads ; i++){
+        pthread_join(threads[i], NULL);
+        stats->essais += lots[i].essais;
+    }
+}
@@ -0,0 +1,57 @@
+/**
+* @file generateur.h
+* @brief Génération aléatoire de niveaux toujours résolubles
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Une salle est creusée par une marche au hasard (cases et blocs 2x2),
+* les caisses sont posées sur leurs cibles, puis le joueur joue la partie
+* à l'envers : il se promène et tire parfois une caisse. Chaque tirage
+* est une poussée à l'envers, le niveau obtenu est donc résoluble. Le
+* solveur note chaque essai (nombre de poussées de sa solution) et le plus
+* long est gardé ; les niveaux trop courts sont refaits.
+*
+* Chaque niveau a sa propre graine, tirée de la graine générale et de son
+* numéro : le résultat ne dépend pas du nombre de threads.
+*/
+
+#ifndef GENERATEUR_H
+#define GENERATEUR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sokoban.h"
+#include "motifs.h"
+
+#define GENERATION_SOLS_MIN      24     // cases creusées
+#define GENERATION_SOLS_MAX      48
+#define GENERATION_CAISSES_MIN   2
+#define GENERATION_CAISSES_MAX   5
+#define GENERATION_PAS_INVERSES  400    // pas de la partie à l'envers
+#define GENERATION_ESSAIS        8      // parties à l'envers par salle
+#define GENERATION_SALLES_MAX    50     // salles avant d'abandonner
+#define GENERATION_POUSSEES_MIN  8      // solution plus courte : refaite
+#define GENERATION_NOEUDS        50000  // limite du solveur par essai
+
+// Niveau généré et sa note
+typedef struct {
+    t_plateau plateau;
+    bool reussi; // faux si aucune salle n'a donné un niveau assez long
+    int nbPoussees; // solution trouvée par le solveur
+    int nbDeplacements;
+} t_niveauGenere;
+
+// Statistiques d'une génération
+typedef struct {
+    long essais; // parties à l'envers notées par le solveur
+    int nbThreads;
+} t_statsGeneration;
+
+bool generer_niveau(uint64_t graine, t_motifs *motifs,
+    t_niveauGenere *niveau, long *essais);
+void generer_niveaux(t_niveauGenere niveaux[], int nbNiveaux,
+    uint64_t graine, t_motifs *motifs, t_statsGeneration *stats);
+
+#endif
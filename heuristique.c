@@ -0,0 +1,482 @@
+/**
+* @file heuristique.c
+* @brief Bornes inférieures du nombre de poussées restantes
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Distances en poussées (calculées en tirant une caisse depuis chaque
+* cible), heuristique de la cible la plus proche et affectation de coût
+* minimal maintenue d'un noeud à l'autre.
+*/
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "heuristique.h"
+
+#define INFINI_HONGROIS     (1 << 29)
+
+/* Fonctions internes */
+
+void tirer_depuis_cible(t_niveau *niveau, int cible);
+int plus_proche_cible(t_niveau *niveau, int numCase);
+int plus_proche_caisse(t_niveau *niveau, t_caisses *caisses, int cible);
+int estimation_proche(t_niveau *niveau, t_caisses *caisses);
+int cout_case(t_niveau *niveau, int ligne, int numCase);
+int choisir_colonne(t_niveau *niveau, t_affectation *affectation,
+    int colonne, int minimum[], int precedente[], bool utilisee[]);
+void augmenter_ligne(t_niveau *niveau, t_affectation *affectation,
+    int ligne);
+void ranger_affectation(t_affectation *affectation, int donnees[]);
+void lire_affectation(t_niveau *niveau, int donnees[],
+    t_affectation *affectation);
+
+/**
+*
+* @brief Calculer la distance en poussées de chaque case vers une cible
+*   (on tire la caisse depuis la cible, le joueur reculant devant elle)
+* @param niveau de type t_niveau, Entrée/Sortie : niveau analysé
+* @param cible de type entier, Entrée : numéro de la cible
+*/
+void tirer_depuis_cible(t_niveau *niveau, int cible)
+{
+    unsigned short *distance = niveau->distance[cible];
+    int file[NB_CASES];
+    int debut = 0, fin = 0;
+    int numCase, suivante, joueur;
+
+    for(numCase = 0 ; numCase < NB_CASES ; numCase++){
+        distance[numCase] = DISTANCE_INFINIE;
+    }
+    distance[niveau->caseCible[cible]] = 0;
+    file[fin++] = niveau->caseCible[cible];
+
+    while(debut < fin){
+        numCase = file[debut++];
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            suivante = niveau->voisin[numCase][dir];
+            joueur = suivante >= 0 ? niveau->voisin[suivante][dir] : -1;
+
+            if(joueur >= 0 && !niveau->mur[suivante] &&
+                !niveau->mur[joueur] &&
+                distance[suivante] == DISTANCE_INFINIE){
+                distance[suivante] = distance[numCase] + 1;
+                file[fin++] = suivante;
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Calculer les distances vers chaque cible et les cases mortes
+* @param niveau de type t_niveau, Entrée/Sortie : niveau analysé
+*/
+void calculer_distances(t_niveau *niveau)
+{
+    for(int cible = 0 ; cible < niveau->nbCibles ; cible++){
+        tirer_depuis_cible(niveau, cible);
+    }
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        // Avec plus de caisses que de cibles, une caisse peut rester
+        // n'importe où : on ne peut plus rien éliminer
+        niveau->caseMorte[numCase] =
+            plus_proche_cible(niveau, numCase) == DISTANCE_INFINIE &&
+            niveau->nbCaisses == niveau->nbCibles;
+    }
+}
+
+/**
+*
+* @brief Distance d'une case à la cible la plus proche
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param numCase de type entier, Entrée : case de la caisse
+* @return entier : distance en poussées
+*/
+int plus_proche_cible(t_niveau *niveau, int numCase)
+{
+    int minimum = DISTANCE_INFINIE;
+
+    for(int cible = 0 ; cible < niveau->nbCibles ; cible++){
+        if(niveau->distance[cible][numCase] < minimum){
+            minimum = niveau->distance[cible][numCase];
+        }
+    }
+
+    return minimum;
+}
+
+/**
+*
+* @brief Distance d'une cible à la caisse la plus proche
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param cible de type entier, Entrée : numéro de la cible
+* @return entier : distance en poussées
+*/
+int plus_proche_caisse(t_niveau *niveau, t_caisses *caisses, int cible)
+{
+    int minimum = DISTANCE_INFINIE;
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        if(case_occupee(caisses, numCase) &&
+            niveau->distance[cible][numCase] < minimum){
+            minimum = niveau->distance[cible][numCase];
+        }
+    }
+
+    return minimum;
+}
+
+/**
+*
+* @brief Somme des distances de chaque caisse à sa cible la plus proche
+*   (de chaque cible à sa caisse la plus proche s'il y a plus de caisses,
+*   pour que l'estimation reste une borne inférieure)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @return entier : estimation, DISTANCE_INFINIE si une caisse est bloquée
+*/
+int estimation_proche(t_niveau *niveau, t_caisses *caisses)
+{
+    int total = 0;
+
+    if(niveau->nbCaisses == niveau->nbCibles){
+        for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+            if(case_occupee(caisses, numCase)){
+                total += plus_proche_cible(niveau, numCase);
+            }
+        }
+    }
+    else{
+        for(int cible = 0 ; cible < niveau->nbCibles ; cible++){
+            total += plus_proche_caisse(niveau, caisses, cible);
+        }
+    }
+
+    return total < DISTANCE_INFINIE ? total : DISTANCE_INFINIE;
+}
+
+/**
+*
+* @brief Coût d'une cible (ligne) pour une caisse posée sur une case
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param ligne de type entier, Entrée : ligne de la cible (à partir de 1)
+* @param numCase de type entier, Entrée : case de la caisse
+* @return entier : distance en poussées
+*/
+int cout_case(t_niveau *niveau, int ligne, int numCase)
+{
+    return niveau->distance[ligne - 1][numCase];
+}
+
+/**
+*
+* @brief Mettre à jour les coûts réduits depuis une colonne et choisir la
+*   prochaine colonne à atteindre (une étape de la méthode hongroise)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param affectation de type t_affectation, Entrée/Sortie : affectation
+* @param colonne de type entier, Entrée : colonne atteinte
+* @param minimum de type tableau d'entiers, Entrée/Sortie : coûts réduits
+* @param precedente de type tableau d'entiers, Entrée/Sortie : chemin
+* @param utilisee de type tableau de booléens, Entrée : colonnes atteintes
+* @return entier : colonne choisie
+*/
+int choisir_colonne(t_niveau *niveau, t_affectation *affectation,
+    int colonne, int minimum[], int precedente[], bool utilisee[])
+{
+    int ligne = affectation->ligneColonne[colonne];
+    int ecart = INFINI_HONGROIS;
+    int suivante = 0;
+    int reduit;
+
+    for(int j = 1 ; j <= affectation->nbColonnes ; j++){
+        if(!utilisee[j]){
+            reduit = cout_case(niveau, ligne, affectation->caseColonne[j]) -
+                affectation->potentielLigne[ligne] -
+                affectation->potentielColonne[j];
+            if(reduit < minimum[j]){
+                minimum[j] = reduit;
+                precedente[j] = colonne;
+            }
+            if(minimum[j] < ecart){
+                ecart = minimum[j];
+                suivante = j;
+            }
+        }
+    }
+
+    for(int j = 0 ; j <= affectation->nbColonnes ; j++){
+        if(utilisee[j]){
+            affectation->potentielLigne[affectation->ligneColonne[j]] += ecart;
+            affectation->potentielColonne[j] -= ecart;
+        }
+        else{
+            minimum[j] -= ecart;
+        }
+    }
+
+    return suivante;
+}
+
+/**
+*
+* @brief Affecter une ligne libre par un chemin augmentant de coût minimal
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param affectation de type t_affectation, Entrée/Sortie : affectation
+* @param ligne de type entier, Entrée : ligne libre
+*/
+void augmenter_ligne(t_niveau *niveau, t_affectation *affectation,
+    int ligne)
+{
+    int minimum[CIBLES_MAX + 1];
+    int precedente[CIBLES_MAX + 1];
+    bool utilisee[CIBLES_MAX + 1];
+    int colonne = 0;
+    int suivante;
+
+    for(int j = 0 ; j <= affectation->nbColonnes ; j++){
+        minimum[j] = INFINI_HONGROIS;
+        utilisee[j] = false;
+    }
+    affectation->ligneColonne[0] = ligne;
+
+    do{
+        utilisee[colonne] = true;
+        colonne = choisir_colonne(niveau, affectation, colonne, minimum,
+            precedente, utilisee);
+    } while(affectation->ligneColonne[colonne] != 0);
+
+    // Inverser le chemin augmentant
+    do{
+        suivante = precedente[colonne];
+        affectation->ligneColonne[colonne] =
+            affectation->ligneColonne[suivante];
+        colonne = suivante;
+    } while(colonne != 0);
+}
+
+/**
+*
+* @brief Calculer entièrement l'affectation de coût minimal
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param affectation de type t_affectation, Sortie : affectation
+*/
+void affectation_complete(t_niveau *niveau, t_caisses *caisses,
+    t_affectation *affectation)
+{
+    memset(affectation, 0, sizeof(t_affectation));
+    affectation->nbLignes = niveau->nbCibles;
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        if(case_occupee(caisses, numCase)){
+            affectation->nbColonnes++;
+            affectation->caseColonne[affectation->nbColonnes] = numCase;
+        }
+    }
+
+    for(int ligne = 1 ; ligne <= affectation->nbLignes ; ligne++){
+        augmenter_ligne(niveau, affectation, ligne);
+    }
+}
+
+/**
+*
+* @brief Réparer l'affectation après le déplacement d'une seule caisse
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param affectation de type t_affectation, Entrée/Sortie : affectation
+* @param ancienneCase de type entier, Entrée : case quittée par la caisse
+* @param nouvelleCase de type entier, Entrée : case atteinte par la caisse
+* Seule la colonne de la caisse change : on la libère, on rend son
+* potentiel admissible puis on réaffecte sa cible par un seul chemin
+* augmentant. Avec plus de caisses que de cibles, on recalcule tout.
+*/
+void deplacer_colonne(t_niveau *niveau, t_affectation *affectation,
+    int ancienneCase, int nouvelleCase)
+{
+    int colonne = 1;
+    int ligne, reduit;
+
+    while(affectation->caseColonne[colonne] != ancienneCase){
+        colonne++;
+    }
+    affectation->caseColonne[colonne] = nouvelleCase;
+
+    if(affectation->nbColonnes != affectation->nbLignes){
+        memset(affectation->ligneColonne, 0, sizeof(int) * (CIBLES_MAX + 1));
+        memset(affectation->potentielLigne, 0, sizeof(int) * (CIBLES_MAX + 1));
+        memset(affectation->potentielColonne, 0,
+            sizeof(int) * (CIBLES_MAX + 1));
+        for(ligne = 1 ; ligne <= affectation->nbLignes ; ligne++){
+            augmenter_ligne(niveau, affectation, ligne);
+        }
+    }
+    else{
+        ligne = affectation->ligneColonne[colonne];
+        affectation->ligneColonne[colonne] = 0;
+
+        affectation->potentielColonne[colonne] = INFINI_HONGROIS;
+        for(int i = 1 ; i <= affectation->nbLignes ; i++){
+            reduit = cout_case(niveau, i, nouvelleCase) -
+                affectation->potentielLigne[i];
+            if(reduit < affectation->potentielColonne[colonne]){
+                affectation->potentielColonne[colonne] = reduit;
+            }
+        }
+
+        augmenter_ligne(niveau, affectation, ligne);
+    }
+}
+
+/**
+*
+* @brief Coût total d'une affectation
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param affectation de type t_affectation, Entrée : affectation
+* @return entier : coût, DISTANCE_INFINIE si une cible est inatteignable
+*/
+int cout_affectation(t_niveau *niveau, t_affectation *affectation)
+{
+    int total = 0;
+    int ligne;
+
+    for(int j = 1 ; j <= affectation->nbColonnes ; j++){
+        ligne = affectation->ligneColonne[j];
+        if(ligne != 0){
+            total += cout_case(niveau, ligne, affectation->caseColonne[j]);
+        }
+    }
+
+    return total < DISTANCE_INFINIE ? total : DISTANCE_INFINIE;
+}
+
+/**
+*
+* @brief Ranger une affectation dans les données d'un noeud
+* @param affectation de type t_affectation, Entrée : affectation
+* @param donnees de type tableau d'entiers, Sortie : données du noeud
+*/
+void ranger_affectation(t_affectation *affectation, int donnees[])
+{
+    int nbColonnes = affectation->nbColonnes;
+    int nbLignes = affectation->nbLignes;
+
+    memcpy(donnees, &affectation->caseColonne[1], sizeof(int) * nbColonnes);
+    memcpy(&donnees[nbColonnes], &affectation->ligneColonne[1],
+        sizeof(int) * nbColonnes);
+    memcpy(&donnees[2 * nbColonnes], &affectation->potentielLigne[1],
+        sizeof(int) * nbLignes);
+    memcpy(&donnees[2 * nbColonnes + nbLignes],
+        &affectation->potentielColonne[1], sizeof(int) * nbColonnes);
+}
+
+/**
+*
+* @brief Relire l'affectation rangée dans les données d'un noeud
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param donnees de type tableau d'entiers, Entrée : données du noeud
+* @param affectation de type t_affectation, Sortie : affectation
+*/
+void lire_affectation(t_niveau *niveau, int donnees[],
+    t_affectation *affectation)
+{
+    int nbColonnes = niveau->nbCaisses;
+    int nbLignes = niveau->nbCibles;
+
+    affectation->nbColonnes = nbColonnes;
+    affectation->nbLignes = nbLignes;
+    affectation->caseColonne[0] = 0;
+    affectation->ligneColonne[0] = 0;
+    affectation->potentielLigne[0] = 0;
+    affectation->potentielColonne[0] = 0;
+
+    memcpy(&affectation->caseColonne[1], donnees, sizeof(int) * nbColonnes);
+    memcpy(&affectation->ligneColonne[1], &donnees[nbColonnes],
+        sizeof(int) * nbColonnes);
+    memcpy(&affectation->potentielLigne[1], &donnees[2 * nbColonnes],
+        sizeof(int) * nbLignes);
+    memcpy(&affectation->potentielColonne[1],
+        &donnees[2 * nbColonnes + nbLignes], sizeof(int) * nbColonnes);
+}
+
+/**
+*
+* @brief Nombre d'entiers à garder par noeud pour une heuristique
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param heuristique de type t_heuristique, Entrée : heuristique
+* @return entier : taille des données d'un noeud
+*/
+int taille_donnees_heuristique(t_niveau *niveau, t_heuristique heuristique)
+{
+    int taille = 0;
+
+    if(heuristique == HEURISTIQUE_AFFECTATION){
+        taille = 3 * niveau->nbCaisses + niveau->nbCibles;
+    }
+
+    return taille;
+}
+
+/**
+*
+* @brief Estimer les poussées restantes depuis la position de départ
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param heuristique de type t_heuristique, Entrée : heuristique
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param donnees de type tableau d'entiers, Sortie : données du noeud
+* @return entier : estimation, DISTANCE_INFINIE si c'est une impasse
+*/
+int estimer_depart(t_niveau *niveau, t_heuristique heuristique,
+    t_caisses *caisses, int donnees[])
+{
+    t_affectation affectation;
+    int estimation = 0;
+
+    if(heuristique == HEURISTIQUE_PROCHE){
+        estimation = estimation_proche(niveau, caisses);
+    }
+    else if(heuristique == HEURISTIQUE_AFFECTATION){
+        affectation_complete(niveau, caisses, &affectation);
+        ranger_affectation(&affectation, donnees);
+        estimation = cout_affectation(niveau, &affectation);
+    }
+
+    return estimation;
+}
+
+/**
+*
+* @brief Estimer les poussées restantes après une poussée, à partir des
+*   données du parent
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param heuristique de type t_heuristique, Entrée : heuristique
+* @param caisses de type t_caisses, Entrée : caisses après la poussée
+* @param donneesParent de type tableau d'entiers, Entrée : données du parent
+* @param ancienneCase de type entier, Entrée : case quittée par la caisse
+* @param nouvelleCase de type entier, Entrée : case atteinte par la caisse
+* @param donnees de type tableau d'entiers, Sortie : données du noeud
+* @return entier : estimation, DISTANCE_INFINIE si c'est une impasse
+*/
+int estimer_poussee(t_niveau *niveau, t_heuristique heuristique,
+    t_caisses *caisses, int donneesParent[], int ancienneCase,
+    int nouvelleCase, int donnees[])
+{
+    t_affectation affectation;
+    int estimation = 0;
+
+    if(heuristique == HEURISTIQUE_PROCHE){
+        estimation = estimation_proche(niveau, caisses);
+    }
+    else if(heuristique == HEURISTIQUE_AFFECTATION){
+        lire_affectation(niveau, donneesParent, &affectation);
+        deplacer_colonne(niveau, &affectation, ancienneCase, nouvelleCase);
+        ranger_affectation(&affectation, donnees);
+        estimation = cout_affectation(niveau, &affectation);
+    }
+
+    return estimation;
+}
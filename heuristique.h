@@ -0,0 +1,45 @@
+/**
+* @file heuristique.h
+* @brief Bornes inférieures du nombre de poussées restantes
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* L'heuristique principale est le coût minimal d'une affectation des
+* caisses aux cibles (méthode hongroise), le coût d'un couple étant la
+* distance en poussées calculée au chargement du niveau. Quand une seule
+* caisse bouge, l'affectation du parent est réparée en une seule étape
+* (une colonne change) au lieu d'être recalculée entièrement.
+*/
+
+#ifndef HEURISTIQUE_H
+#define HEURISTIQUE_H
+
+#include "solveur.h"
+
+// Affectation des cibles (lignes) aux caisses (colonnes), indices à
+// partir de 1 : la ligne et la colonne 0 servent au calcul
+typedef struct {
+    int nbLignes;
+    int nbColonnes;
+    int caseColonne[CIBLES_MAX + 1]; // case de la caisse de chaque colonne
+    int ligneColonne[CIBLES_MAX + 1]; // cible de chaque caisse (0 : aucune)
+    int potentielLigne[CIBLES_MAX + 1];
+    int potentielColonne[CIBLES_MAX + 1];
+} t_affectation;
+
+void calculer_distances(t_niveau *niveau);
+int taille_donnees_heuristique(t_niveau *niveau, t_heuristique heuristique);
+int estimer_depart(t_niveau *niveau, t_heuristique heuristique,
+    t_caisses *caisses, int donnees[]);
+int estimer_poussee(t_niveau *niveau, t_heuristique heuristique,
+    t_caisses *caisses, int donneesParent[], int ancienneCase,
+    int nouvelleCase, int donnees[]);
+
+void affectation_complete(t_niveau *niveau, t_caisses *caisses,
+    t_affectation *affectation);
+void deplacer_colonne(t_niveau *niveau, t_affectation *affectation,
+    int ancienneCase, int nouvelleCase);
+int cout_affectation(t_niveau *niveau, t_affectation *affectation);
+
+#endif
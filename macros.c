@@ -0,0 +1,427 @@
+/**
+* @file macros.c
+* @brief Poussées enchaînées automatiquement (tunnels et salle des cibles)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*/
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "macros.h"
+
+/* Fonctions internes */
+
+bool est_mur(t_niveau *niveau, int numCase);
+bool entre_murs(t_niveau *niveau, int numCase, int axe);
+int salle_depuis(t_niveau *niveau, int entree, int depart, bool salle[]);
+void chercher_salle(t_niveau *niveau);
+void ordonner_salle(t_niveau *niveau);
+bool salle_remplissable(t_niveau *niveau);
+bool continuer_tunnel(t_niveau *niveau, t_caisses *caisses, int joueur,
+    int direction);
+int prochaine_cible_salle(t_niveau *niveau, t_caisses *caisses);
+int chemin_salle(t_niveau *niveau, t_caisses *caisses, int joueur,
+    int cible, t_poussee poussees[]);
+
+/**
+*
+* @brief Savoir si une case est un mur ou hors du plateau
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param numCase de type entier, Entrée : numéro de la case (-1 : dehors)
+* @return vrai si personne ne peut aller sur la case
+*/
+bool est_mur(t_niveau *niveau, int numCase)
+{
+    return numCase < 0 || niveau->mur[numCase];
+}
+
+/**
+*
+* @brief Savoir si une case est bordée de murs perpendiculairement à un axe
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param numCase de type entier, Entrée : numéro de la case
+* @param axe de type entier, Entrée : 0 vertical, 1 horizontal
+* @return vrai si la case est dans un couloir de largeur 1 selon l'axe
+*/
+bool entre_murs(t_niveau *niveau, int numCase, int axe)
+{
+    // Directions perpendiculaires à l'axe : gauche/droite ou haut/bas
+    int cote = (1 - axe) * 2;
+
+    return est_mur(niveau, niveau->voisin[numCase][cote]) &&
+        est_mur(niveau, niveau->voisin[numCase][cote + 1]);
+}
+
+/**
+*
+* @brief Calculer la zone reliée à une case sans passer par l'entrée
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param entree de type entier, Entrée : case qui sépare la zone du reste
+* @param depart de type entier, Entrée : première case de la zone
+* @param salle de type tableau de booléens, Sortie : cases de la zone
+* @return entier : nombre de cibles de la zone, -1 si elle contient une
+*   caisse ou le joueur au départ
+*/
+int salle_depuis(t_niveau *niveau, int entree, int depart, bool salle[])
+{
+    int pile[NB_CASES];
+    int nbPile = 0;
+    int nbCibles = 0;
+    int numCase, suivante;
+
+    memset(salle, false, NB_CASES * sizeof(bool));
+    salle[depart] = true;
+    pile[nbPile++] = depart;
+
+    while(nbPile > 0 && nbCibles >= 0){
+        numCase = pile[--nbPile];
+        if(case_occupee(&niveau->depart.caisses, numCase) ||
+            numCase == niveau->joueurDepart){
+            nbCibles = -1;
+        }
+        else if(case_occupee(&niveau->cibles, numCase)){
+            nbCibles++;
+        }
+
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            suivante = niveau->voisin[numCase][dir];
+            if(!est_mur(niveau, suivante) && suivante != entree &&
+                !salle[suivante]){
+                salle[suivante] = true;
+                pile[nbPile++] = suivante;
+            }
+        }
+    }
+
+    return nbCibles;
+}
+
+/**
+*
+* @brief Chercher la salle des cibles : zone vide au départ, reliée au
+*   reste du niveau par une seule case, qui contient le plus de cibles
+* @param niveau de type t_niveau, Entrée/Sortie : niveau analysé
+*/
+void chercher_salle(t_niveau *niveau)
+{
+    bool salle[NB_CASES];
+    int meilleure = 1; // une salle d'une seule cible n'apporte rien
+    int nbCibles, depart;
+
+    niveau->entreeSalle = -1;
+
+    for(int entree = 0 ; entree < NB_CASES ; entree++){
+        for(int dir = 0 ; !est_mur(niveau, entree) &&
+            !case_occupee(&niveau->cibles, entree) &&
+            dir < NB_DIRECTIONS ; dir++){
+            depart = niveau->voisin[entree][dir];
+
+            if(!est_mur(niveau, depart)){
+                nbCibles = salle_depuis(niveau, entree, depart, salle);
+                if(nbCibles > meilleure){
+                    meilleure = nbCibles;
+                    niveau->entreeSalle = entree;
+                    memcpy(niveau->salle, salle, sizeof(salle));
+                }
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Ranger les cibles de la salle de la plus éloignée de l'entrée à
+*   la plus proche (ordre dans lequel elles sont remplies)
+* @param niveau de type t_niveau, Entrée/Sortie : niveau analysé
+*/
+void ordonner_salle(t_niveau *niveau)
+{
+    int distance[NB_CASES];
+    int file[NB_CASES];
+    int debut = 0, fin = 0;
+    int numCase, suivante, cible;
+
+    memset(distance, -1, sizeof(distance));
+    distance[niveau->entreeSalle] = 0;
+    file[fin++] = niveau->entreeSalle;
+
+    while(debut < fin){
+        numCase = file[debut++];
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            suivante = niveau->voisin[numCase][dir];
+            if(suivante >= 0 && niveau->salle[suivante] &&
+                distance[suivante] < 0){
+                distance[suivante] = distance[numCase] + 1;
+                file[fin++] = suivante;
+            }
+        }
+    }
+
+    niveau->nbCiblesSalle = 0;
+    for(int i = 0 ; i < niveau->nbCibles ; i++){
+        if(niveau->salle[niveau->caseCible[i]]){
+            niveau->ordreSalle[niveau->nbCiblesSalle++] =
+                niveau->caseCible[i];
+        }
+    }
+
+    // Tri par insertion, les salles ont peu de cibles
+    for(int i = 1 ; i < niveau->nbCiblesSalle ; i++){
+        cible = niveau->ordreSalle[i];
+        numCase = i;
+        while(numCase > 0 &&
+            distance[niveau->ordreSalle[numCase - 1]] < distance[cible]){
+            niveau->ordreSalle[numCase] = niveau->ordreSalle[numCase - 1];
+            numCase--;
+        }
+        niveau->ordreSalle[numCase] = cible;
+    }
+}
+
+/**
+*
+* @brief Vérifier que la salle peut être remplie dans l'ordre prévu, une
+*   caisse après l'autre, quel que soit son côté d'arrivée à l'entrée
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @return vrai si chaque cible est atteignable une fois les précédentes
+*   remplies
+*/
+bool salle_remplissable(t_niveau *niveau)
+{
+    t_poussee poussees[POUSSEES_MACRO_MAX];
+    t_caisses caisses;
+    t_caisses remplies = {{0}};
+    bool remplissable = true;
+    int entree = niveau->entreeSalle;
+    int joueur;
+
+    for(int i = 0 ; remplissable && i < niveau->nbCiblesSalle ; i++){
+        for(int dir = 0 ; remplissable && dir < NB_DIRECTIONS ; dir++){
+            joueur = niveau->voisin[entree][dir];
+            if(!est_mur(niveau, joueur) && !niveau->salle[joueur]){
+                caisses = remplies;
+                ajouter_case(&caisses, entree);
+                remplissable = chemin_salle(niveau, &caisses, joueur,
+                    niveau->ordreSalle[i], poussees) > 0;
+            }
+        }
+        ajouter_case(&remplies, niveau->ordreSalle[i]);
+    }
+
+    return remplissable;
+}
+
+/**
+*
+* @brief Repérer les tunnels et la salle des cibles d'un niveau
+* @param niveau de type t_niveau, Entrée/Sortie : niveau analysé
+*/
+void analyser_macros(t_niveau *niveau)
+{
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        for(int axe = 0 ; axe < 2 ; axe++){
+            niveau->tunnel[numCase][axe] = !niveau->mur[numCase] &&
+                !case_occupee(&niveau->cibles, numCase) &&
+                entre_murs(niveau, numCase, axe);
+        }
+    }
+
+    chercher_salle(niveau);
+    if(niveau->entreeSalle >= 0){
+        ordonner_salle(niveau);
+        if(!salle_remplissable(niveau)){
+            niveau->entreeSalle = -1;
+            niveau->nbCiblesSalle = 0;
+        }
+    }
+}
+
+/**
+*
+* @brief Savoir si la caisse qui vient d'être poussée doit continuer :
+*   elle et le joueur sont dans le même tunnel et la case suivante est
+*   libre
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : caisses après la poussée
+* @param joueur de type entier, Entrée : case du joueur (ancienne case de
+*   la caisse)
+* @param direction de type entier, Entrée : direction de la poussée
+* @return vrai si la caisse doit encore être poussée
+*/
+bool continuer_tunnel(t_niveau *niveau, t_caisses *caisses, int joueur,
+    int direction)
+{
+    int caisse = niveau->voisin[joueur][direction];
+    int suivante = niveau->voisin[caisse][direction];
+    int axe = direction / 2;
+
+    return niveau->tunnel[caisse][axe] && niveau->tunnel[joueur][axe] &&
+        case_libre(niveau, caisses, suivante) && !niveau->caseMorte[suivante];
+}
+
+/**
+*
+* @brief Trouver la prochaine cible à remplir dans la salle
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @return entier : case de la cible, -1 si la salle est pleine
+*/
+int prochaine_cible_salle(t_niveau *niveau, t_caisses *caisses)
+{
+    int cible = -1;
+
+    for(int i = 0 ; cible < 0 && i < niveau->nbCiblesSalle ; i++){
+        if(!case_occupee(caisses, niveau->ordreSalle[i])){
+            cible = niveau->ordreSalle[i];
+        }
+    }
+
+    return cible;
+}
+
+/**
+*
+* @brief Chercher les poussées qui amènent la caisse de l'entrée de la
+*   salle jusqu'à une cible de la salle (parcours en largeur sur la case
+*   de la caisse et le côté où se trouve le joueur)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : caisses, dont celle de l'entrée
+* @param joueur de type entier, Entrée : case du joueur, à côté de l'entrée
+* @param cible de type entier, Entrée : cible à atteindre
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+* @return entier : nombre de poussées, 0 si la cible est inaccessible
+*/
+int chemin_salle(t_niveau *niveau, t_caisses *caisses, int joueur,
+    int cible, t_poussee poussees[])
+{
+    // Etat : case de la caisse * NB_DIRECTIONS + côté du joueur
+    int precedent[NB_CASES * NB_DIRECTIONS];
+    int file[NB_CASES * NB_DIRECTIONS];
+    bool atteint[NB_CASES];
+    t_caisses autres = *caisses;
+    t_caisses courantes;
+    int debut = 0, fin = 0;
+    int trouve = -1;
+    int nbPoussees = 0;
+    int etat, position, cote, derriere, arrivee, suivant;
+
+    retirer_case(&autres, niveau->entreeSalle);
+    memset(precedent, -1, sizeof(precedent));
+
+    for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+        if(niveau->voisin[niveau->entreeSalle][dir] == joueur){
+            etat = niveau->entreeSalle * NB_DIRECTIONS + dir;
+            precedent[etat] = etat;
+            file[fin++] = etat;
+        }
+    }
+
+    while(debut < fin && trouve < 0){
+        etat = file[debut++];
+        position = etat / NB_DIRECTIONS;
+        cote = etat % NB_DIRECTIONS;
+        courantes = autres;
+        ajouter_case(&courantes, position);
+        zone_joueur(niveau, &courantes, niveau->voisin[position][cote],
+            atteint);
+
+        for(int dir = 0 ; trouve < 0 && dir < NB_DIRECTIONS ; dir++){
+            derriere = niveau->voisin[position][dir ^ 1];
+            arrivee = niveau->voisin[position][dir];
+            suivant = arrivee * NB_DIRECTIONS + (dir ^ 1);
+
+            if(derriere >= 0 && atteint[derriere] && arrivee >= 0 &&
+                (niveau->salle[arrivee] || arrivee == niveau->entreeSalle) &&
+                case_libre(niveau, &courantes, arrivee) &&
+                !niveau->caseMorte[arrivee] && precedent[suivant] < 0){
+                precedent[suivant] = etat;
+                file[fin++] = suivant;
+                trouve = arrivee == cible ? suivant : -1;
+            }
+        }
+    }
+
+    if(trouve >= 0){
+        for(etat = trouve ; precedent[etat] != etat ; etat = precedent[etat]){
+            nbPoussees++;
+        }
+        for(etat = trouve, suivant = nbPoussees - 1 ;
+            precedent[etat] != etat ; etat = precedent[etat], suivant--){
+            // Le joueur est du côté opposé à la poussée
+            poussees[suivant].caisse = precedent[etat] / NB_DIRECTIONS;
+            poussees[suivant].direction = (etat % NB_DIRECTIONS) ^ 1;
+        }
+    }
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Compléter une poussée par celles qu'elle rend obligatoires
+*   (traversée de tunnel)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : caisses avant la poussée
+* @param caisse de type entier, Entrée : case de la caisse poussée
+* @param direction de type entier, Entrée : direction de la poussée
+* @param poussees de type tableau de t_poussee, Sortie : poussées à faire
+*   (POUSSEES_MACRO_MAX au plus), la première étant celle demandée
+* @return entier : nombre de poussées
+*/
+int etendre_poussee(t_niveau *niveau, t_caisses *caisses, int caisse,
+    int direction, t_poussee poussees[])
+{
+    t_caisses courantes = *caisses;
+    int nbPoussees = 0;
+
+    do{
+        poussees[nbPoussees].caisse = caisse;
+        poussees[nbPoussees].direction = direction;
+        nbPoussees++;
+
+        retirer_case(&courantes, caisse);
+        caisse = niveau->voisin[caisse][direction];
+        ajouter_case(&courantes, caisse);
+    }while(continuer_tunnel(niveau, &courantes,
+        poussees[nbPoussees - 1].caisse, direction));
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Prolonger une poussée (voir etendre_poussee) qui amène une caisse
+*   à l'entrée de la salle des cibles depuis l'extérieur par celles qui la
+*   rangent sur la prochaine cible libre de la salle
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : caisses avant les poussées
+* @param poussees de type tableau de t_poussee, Entrée/Sortie : poussées
+*   d'une même caisse, complétées par le rangement
+* @param nbPoussees de type entier, Entrée : nombre de poussées données
+* @return entier : nombre de poussées, nbPoussees si la caisse n'entre
+*   pas dans la salle ou ne peut pas y être rangée
+*/
+int ranger_dans_salle(t_niveau *niveau, t_caisses *caisses,
+    t_poussee poussees[], int nbPoussees)
+{
+    t_caisses courantes = *caisses;
+    int joueur = poussees[nbPoussees - 1].caisse;
+    int caisse = niveau->voisin[joueur][poussees[nbPoussees - 1].direction];
+    int cible;
+
+    retirer_case(&courantes, poussees[0].caisse);
+    ajouter_case(&courantes, caisse);
+
+    if(caisse == niveau->entreeSalle && !niveau->salle[joueur]){
+        cible = prochaine_cible_salle(niveau, &courantes);
+        if(cible >= 0){
+            nbPoussees += chemin_salle(niveau, &courantes, joueur, cible,
+                &poussees[nbPoussees]);
+        }
+    }
+
+    return nbPoussees;
+}
@@ -0,0 +1,30 @@
+/**
+* @file macros.h
+* @brief Poussées enchaînées automatiquement (tunnels et salle des cibles)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Une caisse poussée dans un tunnel (couloir de largeur 1, sans cible) ne
+* peut qu'être poussée jusqu'à sa sortie : la recherche fait toutes ces
+* poussées d'un coup. Une caisse qui arrive à l'entrée de la salle des
+* cibles peut en plus être amenée directement sur la prochaine cible libre
+* de la salle, les cibles étant remplies de la plus éloignée à la plus
+* proche : la recherche essaie ce rangement en plus de la poussée seule,
+* qui reste possible.
+*/
+
+#ifndef MACROS_H
+#define MACROS_H
+
+#include "solveur.h"
+
+#define POUSSEES_MACRO_MAX  (NB_CASES * NB_DIRECTIONS + TAILLE)
+
+void analyser_macros(t_niveau *niveau);
+int etendre_poussee(t_niveau *niveau, t_caisses *caisses, int caisse,
+    int direction, t_poussee poussees[]);
+int ranger_dans_salle(t_niveau *niveau, t_caisses *caisses,
+    t_poussee poussees[], int nbPoussees);
+
+#endif
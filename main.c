@@ -22,230 +22,153 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#include <signal.h>
+#include <time.h>
+#include <dirent.h>
+#include <poll.h>
 
-#define TAILLE 12
+#include "sokoban.h"
+#include "moteur.h"
+#include "touches.h"
+#include "motifs.h"
+#include "conseil.h"
+#include "surveillance.h"
+#include "cache.h"
+#include "trace.h"
+#include "scores.h"
+#include "enregistrement.h"
+#include "partie.h"
+#include "affichage.h"
 
-/* Définition des touches */
+/* Images (les touches tapées entre deux images sont jouées d'un coup) */
 
-#define MOVE_LEFT   'q'
-#define MOVE_RIGHT  'd'
-#define MOVE_DOWN   's'
-#define MOVE_UP     'z'
-#define GIVE_UP     'x'
-#define RESTART     'r'
-#define ZOOM_IN     '+'
-#define ZOOM_OUT    '-'
-#define UNDO        'u'
+#define IMAGES_PAR_SECONDE  60
+#define INTERVALLE_IMAGE    (1000000000L / IMAGES_PAR_SECONDE)  // en ns
+#define ATTENTE_MAX_MS      250  // attente d'une touche sans autre raison
 
-#define MAX_DEP     999
+/* Ligne de commande */
 
-/* Définition des caractères */
+#define SORTIE_NON_GAGNE    2    // code de sortie sans affichage
 
-const char PLAYER           = '@';
-const char MUR              = '#';
-const char CAISSE           = '$';
-const char CIBLE            = '.';
-const char PLAYER_SUR_CIBLE = '+';
-const char CAISSE_SUR_CIBLE = '*';
-const char VIDE             = ' ';
+/* Statistiques (voir scores.h) */
 
-const int ZOOM_MAX          = 3;
-const int ZOOM_MIN          = 1;
+#define JOUEUR_INCONNU      "joueur" // si USER n'est pas défini
 
-const char FIN_COULEUR[10]  = "\033[0m";
-const char ROUGE[10]        = "\033[31m";
-const char VERT[10]         = "\033[32m";
-const char JAUNE[10]        = "\033[33m";
+/* Définition des constantes */
 
+// Touches traitées sans attendre de saisie (étape "moteur" de la trace)
+const char TOUCHES_MOTEUR[8] = {
+    MOVE_UP, MOVE_LEFT, MOVE_DOWN, MOVE_RIGHT, UNDO, PUSH_THROUGH, '\0'
+};
 
-/* Définition des variables de stockage */
+// Touches qui posent une question sous le plateau affiché
+const char TOUCHES_SAISIE[4] = {GIVE_UP, RESTART, '\0'};
 
-#define DEP_SOK_GAU        'g'
-#define DEP_SOK_HAU        'h'
-#define DEP_SOK_BAS        'b'
-#define DEP_SOK_DRO        'd'
-#define DEP_SOK_CAI_G      'G'
-#define DEP_SOK_CAI_H      'H'
-#define DEP_SOK_CAI_B      'B'
-#define DEP_SOK_CAI_D      'D'
 
-/* Définition du tableau */
+/* Définition des structures */
 
-typedef char t_plateau[TAILLE][TAILLE];
-typedef char t_tabDeplacement[MAX_DEP];
-
-// Structure déplacements
-typedef struct {
-    t_tabDeplacement liste; // liste des déplacements (pour stocker et undo)
-    int nbDeplacements;
-} t_deplacements;
-
-// Structure joueur
-typedef struct {
-    int posX;
-    int posY;
-} t_joueur;
-
-// Structure partie
+// Options de la ligne de commande
 typedef struct {
-    bool estFinis; // est ce que le jeu est finis, pour la boucle
-    char nomFichier[30]; // nom du fichier de jeu
-    int zoom; // niveau de zoom 1 2 3
-    int tentatives; // nombre de tentatives (quand on recommence : tentative ++)
-    t_deplacements deplacements;
-    t_plateau plateau;
-    t_joueur joueur;
-} t_partie;
+    char niveau[TAILLE_NOM_FICHIER]; // vide : le demander au joueur
+    char *pack; // dossier de niveaux, l'un d'eux est choisi par index
+    int index; // à partir de 1, dans l'ordre alphabétique des fichiers
+    char *deplacements; // fichier .dep joué au départ
+    char *sortie; // plateau enregistré à la fin
+    bool sansAffichage; // jouer les déplacements, sans terminal ni question
+    bool scores; // afficher les records du niveau, sans jouer
+    char *enregistrement; // session enregistrée (voir enregistrement.h)
+    char *rejeu; // session à rejouer sans affichage
+} t_arguments;
+
+// Passe à 1 quand le terminal est redimensionné (SIGWINCH)
+volatile sig_atomic_t tailleTerminalChangee = 0;
 
 /* Fonctions */
 
-void charger_partie(t_plateau plateau, char fichier[]);
-void enregistrer_partie(t_plateau plateau, char fichier[]);
 int kbhit();
-void enregistrer_deplacements(t_tabDeplacement t, int nb, char fic[]);
 
 void initialiser_jeu(t_partie *jeu);
-void afficher_entete(t_partie jeu);
-void afficher_plateau(t_partie jeu);
-void afficher_case(t_partie jeu, int ligne, int colonne);
+void signaler_redimensionnement(int signal);
+void jouer_touches_en_attente(t_partie *jeu);
 bool demarrer_partie(t_partie *jeu);
-void position_joueur(t_partie *jeu);
-bool gagne(t_partie jeu);
-void deplacer(t_partie *jeu, int depX, int depY);
-void afficher_ligne(int longueur);
-int afficher_encadre(char texte[]);
+void demander_conseil(t_partie *jeu);
+char sans_joueur(char contenu);
+bool suivre_resolubilite(t_partie *jeu);
 void gerer_sauvegarde(t_partie *jeu);
-void gestion_deplacement_caisse(char *positionSuivante,
-    char *positionApresSuivante, t_partie *jeu);
 void gerer_redemarrage(t_partie *jeu);
 void gerer_touches(t_partie *jeu, char touche);
-void stocker_deplacement(t_partie *jeu, int depX, int depY, int type);
-void retour_arriere(t_partie *jeu);
 void initialiser_jeu(t_partie *jeu);
-int recuperer_lignes_utiles(t_partie jeu);
 void gerer_gagner(t_partie *jeu);
+int compter_poussees(t_moteur *moteur);
+void noter_victoire(t_partie *jeu);
+void afficher_records(t_statsNiveau *stats);
+void attendre_evenement(t_partie *jeu);
+void boucle_jeu(t_partie *jeu);
+void preparer_niveau(t_partie *jeu);
+bool lire_arguments(int argc, char *argv[], t_arguments *arguments);
+void afficher_utilisation(char programme[]);
+int est_niveau(const struct dirent *entree);
+bool choisir_dans_pack(t_arguments *arguments);
+int charger_arguments(t_arguments *arguments, t_moteur *moteur);
+bool commencer_niveau_arguments(t_partie *jeu, t_arguments *arguments);
+int jouer_sans_affichage(t_arguments *arguments);
+int afficher_scores_niveau(t_arguments *arguments);
 
 /**
 *
 * @brief Récupérer les infos du niveau, lancer le jeu et gérer les touches
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments (voir
+*   afficher_utilisation)
 * @return entier : code de sortie
 */
-int main()
+int main(int argc, char *argv[])
 {
     /* Variables */
-    char touche = '\0';
     t_partie jeu;
+    t_arguments arguments;
+    int code = EXIT_SUCCESS;
+    bool commencee;
 
-    initialiser_jeu(&jeu);
-
-    if(demarrer_partie(&jeu)){
-
-        position_joueur(&jeu);
-
-        while(!jeu.estFinis)
-        {
-            if (kbhit()){
-                touche = getchar();
-
-                gerer_touches(&jeu, touche);
-
-                if(!jeu.estFinis){
-                    afficher_entete(jeu);
-                    afficher_plateau(jeu);
-                }
-
-                if(gagne(jeu)){
-                    gerer_gagner(&jeu);
-                }
-            }
-        }
-    }
-
-    return 0;
-}
-
-/**
-*
-* @brief Affichage de l'entête
-* @param jeu de type t_partie, Entrée : structure de la partie.
-*
-*/
-void afficher_entete(t_partie jeu)
-{
-    int longueurTexte;
-
-    system("clear");
-    longueurTexte = afficher_encadre("SOKOBAN v2 - Liam CHARPENTIER");
-
-    printf("Fichier chargé : %s\n", jeu.nomFichier);
-    afficher_ligne(longueurTexte);
-
-    printf("Haut : %c | Bas : %c\nGauche : %c | Droite : %c\n",
-        MOVE_UP, MOVE_DOWN, MOVE_LEFT, MOVE_RIGHT
-    );
-    printf("Zoomer : %c | Dézoomer : %c\n",
-        ZOOM_IN, ZOOM_OUT
-    );
-    printf("Abandonner : %c | Recommencer : %c | Action précédente : %c\n", 
-        GIVE_UP, RESTART, UNDO
-    );
-    afficher_ligne(longueurTexte);
-
-    printf("Déplacements : %d\n\n", jeu.deplacements.nbDeplacements);
-    afficher_ligne(longueurTexte);
-}
-
-
-/**
-*
-* @brief Affichage une case du plateau
-* @param plateau de type t_partie, Entrée : structure de la partie
-* @param ligne de type entier, Entrée : indice de la ligne
-* @param colonne de type entier, Entrée : indice de la colonne
-* Les joueurs sur une cible sont seulement représentés pas un joueur
-* Les caisses sur une cible sont seulement représentés par une caisse
-* Eléments importants en couleur
-*
-*/
-void afficher_case(t_partie jeu, int ligne, int colonne)
-{
-    if(jeu.plateau[ligne][colonne] == PLAYER){
-        printf("%s%c%s", JAUNE, PLAYER, FIN_COULEUR);
-    }
-    else if(jeu.plateau[ligne][colonne] == PLAYER_SUR_CIBLE){
-        printf("%s%c%s", ROUGE, PLAYER, FIN_COULEUR);
+    if(!lire_arguments(argc, argv, &arguments)){
+        afficher_utilisation(argv[0]);
+        code = EXIT_FAILURE;
     }
-    else if (jeu.plateau[ligne][colonne] == CAISSE_SUR_CIBLE){
-        printf("%s%c%s", VERT, CAISSE, FIN_COULEUR);
+    else if(arguments.rejeu != NULL){
+        code = rejouer_session(arguments.rejeu);
     }
-    else if (jeu.plateau[ligne][colonne] == CIBLE){
-        printf("%s%c%s", ROUGE, CIBLE, FIN_COULEUR);
+    else if(arguments.scores){
+        code = afficher_scores_niveau(&arguments);
     }
-    else {
-        printf("%c", jeu.plateau[ligne][colonne]);
+    else if(arguments.sansAffichage){
+        code = jouer_sans_affichage(&arguments);
     }
-}
-
+    else{
+        initialiser_jeu(&jeu);
+        jeu.enregistrement = lancer_enregistrement(arguments.enregistrement);
+        commencee = arguments.niveau[0] != '\0' ?
+            commencer_niveau_arguments(&jeu, &arguments) :
+            demarrer_partie(&jeu);
+        if(commencee){
+            position_joueur(&jeu.moteur);
+            boucle_jeu(&jeu);
+        }
+        if(commencee && arguments.sortie != NULL){
+            enregistrer_partie(jeu.moteur.plateau, arguments.sortie);
+        }
 
-/**
-*
-* @brief Affichage du plateau
-* @param plateau de type t_partie, Entrée : structure de la partie
-*
-*/
-void afficher_plateau(t_partie jeu)
-{
-    for (int ligne = 0 ; ligne < recuperer_lignes_utiles(jeu) ; ligne++){
-        for(int i = 0;i<jeu.zoom;i++){
-            for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-                for(int i = 0;i<jeu.zoom;i++){
-                    afficher_case(jeu, ligne, colonne);
-                }
-                
-            }
-            printf("\n");
+        if(jeu.surveillance != NULL){
+            arreter_surveillance(jeu.surveillance);
         }
+        fermer_cache(&jeu.cache);
+        fermer_scores(&jeu.scores);
+        arreter_enregistrement(jeu.enregistrement);
+        fermer_trace(&jeu.trace);
+        code = commencee || arguments.niveau[0] == '\0' ? EXIT_SUCCESS :
+            EXIT_FAILURE;
     }
+
+    return code;
 }
 
 /**
@@ -257,7 +180,7 @@ void afficher_plateau(t_partie jeu)
 */
 bool demarrer_partie(t_partie *jeu)
 {
-    char nomDuFichier[30];
+    char nomDuFichier[TAILLE_NOM_FICHIER];
     bool commencerPartie = true;
     afficher_encadre("SOKOBAN v2");
 
@@ -272,14 +195,9 @@ bool demarrer_partie(t_partie *jeu)
         commencerPartie = false;
     }
     else{
-        jeu->deplacements.nbDeplacements = 0;
-
-        afficher_entete(*jeu);
-        charger_partie(jeu->plateau, jeu->nomFichier);
-
-        position_joueur(jeu);
-
-        afficher_plateau(*jeu);
+        charger_niveau(&jeu->moteur, jeu->nomFichier);
+        preparer_niveau(jeu);
+        rafraichir_affichage(jeu);
     }
 
     return commencerPartie;
@@ -287,191 +205,73 @@ bool demarrer_partie(t_partie *jeu)
 
 /**
 *
-* @brief Récupérer la position x et y du joueur
-* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
-*
+* @brief Demander au solveur la prochaine poussée à faire (affichée dans
+*   l'entête jusqu'au prochain déplacement)
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
 */
-void position_joueur(t_partie *jeu)
+void demander_conseil(t_partie *jeu)
 {
-    bool joueurTrouve = false;
-    int ligne = 0;
-    int colonne = 0;
-
-    while(!joueurTrouve && ligne < TAILLE){
-        while(!joueurTrouve && colonne < TAILLE){
-            if(jeu->plateau[ligne][colonne] == PLAYER ||
-                jeu->plateau[ligne][colonne] == PLAYER_SUR_CIBLE){
-                jeu->joueur.posX = ligne;
-                jeu->joueur.posY = colonne;
-                joueurTrouve = true;
-            }
-            colonne++;
-        }
-        colonne = 0;
-        ligne++;
+    if(!conseiller_poussee(&jeu->conseil, jeu->moteur.plateau, &jeu->motifs,
+        &jeu->cache, &jeu->pousseeConseillee)){
+        jeu->pousseeConseillee.caisse = -1;
     }
+    jeu->coupConseil = jeu->moteur.deplacements.nbDeplacements;
 }
 
 /**
 *
-* @brief Savoir si la partie est gagnée
-* @param plateau de type t_partie, Entrée : structure de la partie
-* @return vrai si la partie est gagnée sinon faux
+* @brief Récupérer le contenu d'une case sans le joueur
+* @param contenu de type caractère, Entrée : contenu de la case
+* @return caractère : contenu de la case une fois le joueur parti
 */
-bool gagne(t_partie jeu)
+char sans_joueur(char contenu)
 {
-    bool aGagner = true;
-
-    for (int ligne = 0 ; ligne < TAILLE ; ligne++){
-        for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-            // Si y a encore une cible ou qu'un joueur est sur une cible pas encore gagné
-            if(
-                jeu.plateau[ligne][colonne] == CIBLE ||
-                jeu.plateau[ligne][colonne] == PLAYER_SUR_CIBLE
-            ){
-                aGagner = false;
-            }
-        }
-    }
-
-    return aGagner;
-}
-
-/**
-*
-* @brief Gérer le déplacement d'une caissez
-* @param positionSuivante de type t_plateau, Entrée : position après le joueur
-* @param positionApresSuivante de type entier, Entrée : position encore après
-* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
-*/
-void gestion_deplacement_caisse(char *positionSuivante,
-    char *positionApresSuivante, t_partie *jeu){
-
-    // Déplacer la caisse et si c'est une cible on met une caisse sur une cible
-    if(*positionApresSuivante == CIBLE){
-        *positionApresSuivante = CAISSE_SUR_CIBLE;
-    }
-    else{
-        *positionApresSuivante = CAISSE;
-    }
-            
-    // Déplacer le joueur et si c'est une cible ou une caisse sur une cible,
-    //on met le joueur sur une cible sinon on met juste un joueur
-    if(*positionSuivante == CIBLE || *positionSuivante == CAISSE_SUR_CIBLE){
-        *positionSuivante = PLAYER_SUR_CIBLE;
-    }
-    else{
-        *positionSuivante = PLAYER;
-    }
+    char resultat = contenu;
 
-    // Si le joueur est sur une cible on la remet
-    if(jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] == PLAYER_SUR_CIBLE){
-        jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] = CIBLE;
+    if(contenu == PLAYER){
+        resultat = VIDE;
     }
-    else
-    {
-        jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] = VIDE;
+    else if(contenu == PLAYER_SUR_CIBLE){
+        resultat = CIBLE;
     }
 
+    return resultat;
 }
 
 /**
 *
-* @brief Faire se déplacer le joueur
-* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
-* @param depX de type entier, Entrée : position X du joueur.
-* @param depY de type entier, Entrée : position Y du joueur.
+* @brief Envoyer la position à vérifier quand une caisse a bougé, puis
+*   relever le verdict de la vérification en arrière-plan (sans attendre)
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+* @return vrai si le verdict affiché a changé
 */
-void deplacer(t_partie *jeu, int depX, int depY)
+bool suivre_resolubilite(t_partie *jeu)
 {
-
-    char *positionSuivante =
-        &jeu->plateau[jeu->joueur.posX+depX][jeu->joueur.posY+depY];
-    char *positionApresSuivante =
-        &jeu->plateau[jeu->joueur.posX+depX+depX][jeu->joueur.posY+depY+depY];
-
-    // Si on est pas contre un bord et qu'on ne sort pas du plateau
-    if(*positionSuivante != MUR && jeu->joueur.posX+depX < TAILLE &&
-        jeu->joueur.posY+depY < TAILLE
-        && jeu->joueur.posX+depX >= 0 && jeu->joueur.posY+depY >= 0)
-    {
-        // Si on ne pousse pas de caisse
-        if(*positionSuivante != CAISSE && *positionSuivante != CAISSE_SUR_CIBLE)
-        {
-
-            // Si la position suivante est une cible
-            //on ajoute un joueur sur la cible sinon on met juste un joueur
-            if(*positionSuivante == CIBLE)
-            {
-                *positionSuivante = PLAYER_SUR_CIBLE;
-            }
-            else{
-                *positionSuivante = PLAYER;
-            }
-            
-            // Si le joueur est sur une cible on la remet sinon on met du vide
-            if(jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] == PLAYER_SUR_CIBLE){
-                jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] = CIBLE;
-            }
-            else
-            {
-                jeu->plateau[jeu->joueur.posX][jeu->joueur.posY] = VIDE;
-            }
-
-            jeu->joueur.posX += depX;
-            jeu->joueur.posY += depY;
-
-
-            stocker_deplacement(jeu, depX, depY, 0);
+    bool caissesDeplacees = false;
+    bool enCours = false;
+    bool change = false;
+    t_verdict verdict;
+
+    if(jeu->surveillance != NULL){
+        for(int numCase = 0 ; numCase < TAILLE * TAILLE ; numCase++){
+            caissesDeplacees = caissesDeplacees ||
+                sans_joueur(jeu->moteur.plateau[numCase / TAILLE][numCase % TAILLE])
+                != sans_joueur(jeu->plateauSurveille[numCase / TAILLE]
+                [numCase % TAILLE]);
         }
-        // Sinon on tente de pousser une caisse mais on vérifie que la case derrière
-        // n'est pas un mur ou une autre caisse
-        else if(
-            *positionApresSuivante != MUR &&
-            *positionApresSuivante != CAISSE &&
-            *positionApresSuivante != CAISSE_SUR_CIBLE
-        ){
-            gestion_deplacement_caisse(positionSuivante, positionApresSuivante, jeu);
-            stocker_deplacement(jeu, depX, depY, 1);
-
-            jeu->joueur.posX += depX;
-            jeu->joueur.posY += depY;
+        if(caissesDeplacees){
+            memcpy(jeu->plateauSurveille, jeu->moteur.plateau, sizeof(t_plateau));
+            surveiller_position(jeu->surveillance, jeu->moteur.plateau);
         }
-    }
-}
 
-/**
-*
-* @brief Afficher une ligne de longeur X du caractère *
-* @param longueur de type entier, Entrée : longueur de la ligne.
-*/
-void afficher_ligne(int longueur){
-    for (int i = 0 ; i < longueur ; i++)
-    {
-        printf("*");
+        verdict = lire_surveillance(jeu->surveillance, &enCours);
+        change = verdict != jeu->resolubilite ||
+            enCours != jeu->verificationEnCours;
+        jeu->resolubilite = verdict;
+        jeu->verificationEnCours = enCours;
     }
 
-    printf("\n");
-}
-
-/**
-*
-* @brief Afficher un encadré autour du texte
-* @param texte de type chaîne de caractères, Entrée : texte à afficher.
-* @return longeur du texte
-*/
-int afficher_encadre(char texte[]){
-
-    // taille du texte
-    int longueur = strlen(texte);
-    int largeur = longueur + 4;
-
-    afficher_ligne(largeur);
-    printf("* %s *\n", texte);
-    afficher_ligne(largeur);
-    printf("\n");
-
-    return largeur;
+    return change;
 }
 
 /**
@@ -493,7 +293,7 @@ void gerer_sauvegarde(t_partie *jeu){
         printf("Dans quel fichier voulez vous sauvegarder la partie : ");
         scanf("%s", nomDuFichierSauvegarde);
 
-        enregistrer_partie(jeu->plateau, nomDuFichierSauvegarde);
+        enregistrer_partie(jeu->moteur.plateau, nomDuFichierSauvegarde);
         printf("Partie sauvegardée !\n\n");
     }
 
@@ -502,18 +302,19 @@ void gerer_sauvegarde(t_partie *jeu){
         printf("Dans quel fichier voulez vous sauvegarder les déplacements : ");
         scanf("%s", nomDuFichierSauvegarde);
 
-        enregistrer_deplacements(jeu->deplacements.liste,
-            jeu->deplacements.nbDeplacements, nomDuFichierSauvegarde);
+        enregistrer_deplacements(jeu->moteur.deplacements.liste,
+            jeu->moteur.deplacements.nbDeplacements, nomDuFichierSauvegarde);
         printf("Déplacements sauvegardée !\n\n");
     }
 
     printf("\n\n");
 
     afficher_encadre("Vous avez abandonner :/");
+    noter_evenement(jeu->enregistrement, EVENEMENT_ABANDON,
+        jeu->moteur.deplacements.nbDeplacements);
 
     if(demarrer_partie(jeu)){
-        jeu->deplacements.nbDeplacements = 0;
-        position_joueur(jeu); 
+        demarrer_niveau(&jeu->moteur);
     }
 }
 
@@ -531,10 +332,12 @@ void gerer_redemarrage(t_partie *jeu){
 
     if(touche == 'o'){
         // On recharge le fichier 
-        charger_partie(jeu->plateau, jeu->nomFichier);
-        position_joueur(jeu);
-        jeu->deplacements.nbDeplacements = 0;
+        charger_niveau(&jeu->moteur, jeu->nomFichier);
+        jeu->coupBloquant = -1;
+        jeu->coupConseil = -1;
         jeu->tentatives++;
+        jeu->debutTentative = lire_horloge();
+        noter_evenement(jeu->enregistrement, EVENEMENT_RECOMMENCER, 0);
     }
 }
 
@@ -545,20 +348,23 @@ void gerer_redemarrage(t_partie *jeu){
 * @param touche de type caractère, Entrée : touche pressée.
 */
 void gerer_touches(t_partie *jeu, char touche){
-        
+    long debut = debut_trace(&jeu->trace);
+
+    noter_evenement(jeu->enregistrement, EVENEMENT_TOUCHE,
+        (unsigned char)touche);
     switch(touche)
     {
         case MOVE_UP:
-            deplacer(jeu, -1, 0);
+            jouer_coup(jeu, -1, 0);
             break;
         case MOVE_LEFT:
-            deplacer(jeu, 0, -1);
+            jouer_coup(jeu, 0, -1);
             break;
         case MOVE_DOWN:
-            deplacer(jeu, 1, 0);
+            jouer_coup(jeu, 1, 0);
             break;
         case MOVE_RIGHT:
-            deplacer(jeu, 0, 1);
+            jouer_coup(jeu, 0, 1);
             break;
         case GIVE_UP:
             gerer_sauvegarde(jeu);
@@ -567,264 +373,584 @@ void gerer_touches(t_partie *jeu, char touche){
             if(jeu->zoom < ZOOM_MAX){
                 jeu->zoom++;
             }
+            noter_evenement(jeu->enregistrement, EVENEMENT_ZOOM, jeu->zoom);
             break;
             
         case ZOOM_OUT:
             if(jeu->zoom > ZOOM_MIN){
                 jeu->zoom--;
             }
+            noter_evenement(jeu->enregistrement, EVENEMENT_ZOOM, jeu->zoom);
             break;
 
         case UNDO:
-            if (jeu->deplacements.nbDeplacements > 0){
-                retour_arriere(jeu);
-            }
-            
+            annuler_coup(jeu);
             break;
 
         case RESTART:
             gerer_redemarrage(jeu);
             break;
+
+        case PUSH_THROUGH:
+            pousser_jusqu_au_bout(jeu);
+            break;
+
+        case HINT:
+            demander_conseil(jeu);
+            break;
+    }
+
+    // Les touches qui attendent une saisie du joueur ne sont pas mesurées
+    if(touche != '\0' && strchr(TOUCHES_MOTEUR, touche) != NULL){
+        noter_trace(&jeu->trace, "moteur", debut, touche);
     }
 }
 
 /**
 *
-* @brief Stocker les déplacements dans le talbeau
+* @brief Définir les valeurs de la partie par défaut
 * @param plateau de type t_partie, Entrée/Sortie : structure de la partie
-* @param depX de type entier, Entrée : Indice de déplacement x
-* @param depY de type entier, Entrée : Indice de déplacement y
-* @param type de type entier, Entrée : Type de déplacement
-* 0 = joueur simple, 1 = joueur et caisse
+*
 */
-void stocker_deplacement(t_partie *jeu, int depX, int depY, int type){
+void initialiser_jeu(t_partie *jeu){
+    jeu->moteur.deplacements.nbDeplacements = 0;
+    jeu->estFinis = false;
+    jeu->zoom = ZOOM_MIN;
+    jeu->tentatives  = 1;
+    jeu->coupBloquant = -1;
+    jeu->coupConseil = -1;
+    oublier_conseil(&jeu->conseil);
+    ouvrir_motifs(FICHIER_MOTIFS, &jeu->motifs);
+    ouvrir_cache(FICHIER_CACHE, &jeu->cache);
+    ouvrir_scores(FICHIER_SCORES, &jeu->scores);
+    ouvrir_trace(&jeu->trace, getenv(VARIABLE_TRACE));
+    jeu->enregistrement = NULL;
+    jeu->imageEnRetard = false;
+    jeu->derniereImage = 0;
+    // Aucune position envoyée : la première sera vérifiée
+    memset(jeu->plateauSurveille, MUR, sizeof(t_plateau));
+    jeu->resolubilite = VERDICT_INCONNU;
+    jeu->verificationEnCours = false;
+    jeu->surveillance = lancer_surveillance(&jeu->motifs, &jeu->cache);
+
+    jeu->vue.premiereLigne = 0;
+    jeu->vue.premiereColonne = 0;
+    jeu->vue.nbLignes = 0;
+    jeu->vue.nbColonnes = 0;
+    lire_taille_terminal(&jeu->vue);
+    signal(SIGWINCH, signaler_redimensionnement);
+}
 
-    if(depX == -1 && depY == 0){
-        // syntaxe raccourcie de if pour la val d'une variable
-        // x = a ? b : c
-        // si a : x = b sinon x = c
-        jeu->deplacements.liste[jeu->deplacements.nbDeplacements] =
-            type ? DEP_SOK_CAI_H : DEP_SOK_HAU;
-    }
-    else if(depX == 0 && depY == -1){
-        jeu->deplacements.liste[jeu->deplacements.nbDeplacements] =
-            type ? DEP_SOK_CAI_G : DEP_SOK_GAU;
+/**
+*
+* @brief Noter que le terminal a été redimensionné (appelée sur SIGWINCH)
+* @param signal de type entier, Entrée : numéro du signal reçu
+*
+*/
+void signaler_redimensionnement(int signal){
+    (void)signal;
+    tailleTerminalChangee = 1;
+}
+
+/**
+*
+* @brief Jouer toutes les touches déjà tapées (collage, répétition,
+*   connexion lente) sans afficher chaque étape : seul l'état final sera
+*   affiché, par la boucle principale
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+* On s'arrête après une touche qui pose une question ou une victoire
+*
+*/
+void jouer_touches_en_attente(t_partie *jeu){
+    char touche;
+    long debut;
+    bool question;
+    bool victoire = false;
+    bool continuer = true;
+
+    while(continuer){
+        debut = debut_trace(&jeu->trace);
+        touche = getchar();
+        noter_trace(&jeu->trace, "lecture_touche", debut, touche);
+
+        // La question s'affiche sous le plateau : il doit être à jour
+        question = touche != '\0' && strchr(TOUCHES_SAISIE, touche) != NULL;
+        if(question && jeu->imageEnRetard){
+            rafraichir_affichage(jeu);
+        }
+
+        debut = debut_trace(&jeu->trace);
+        gerer_touches(jeu, touche);
+        noter_trace(&jeu->trace, "gerer_touches", debut, touche);
+        jeu->imageEnRetard = true;
+
+        debut = debut_trace(&jeu->trace);
+        victoire = !jeu->estFinis && gagne(&jeu->moteur);
+        noter_trace(&jeu->trace, "victoire", debut, '\0');
+        continuer = !question && !victoire && !jeu->estFinis && kbhit();
     }
-    else if(depX == 1 && depY == 0){
-        jeu->deplacements.liste[jeu->deplacements.nbDeplacements] =
-            type ? DEP_SOK_CAI_B : DEP_SOK_BAS;
+
+    if(!jeu->estFinis){
+        suivre_resolubilite(jeu);
     }
-    else{
-        jeu->deplacements.liste[jeu->deplacements.nbDeplacements] =
-            type ? DEP_SOK_CAI_D : DEP_SOK_DRO;
+    if(victoire){
+        // Le plateau gagnant reste affiché au-dessus du message
+        rafraichir_affichage(jeu);
+        gerer_gagner(jeu);
     }
-
-    jeu->deplacements.nbDeplacements++;
 }
 
 /**
 *
-* @brief Renvoyer le type de déplacement pour le retour arrière
-*   (coordonnées + si c'est une caisse)
-* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
-* @param depCaisse de type booléen, Entrée/Sortie : si on déplace une caisse
-* @param depX de type entier, Entrée/Sortie : déplacement axe x
-* @param depY de type entier, Entrée/Sortie : déplacement axe y
+* @brief Afficher la victoire et gérer le redémarrage
+* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
 *
 */
-void recuperer_deplacement(t_partie *jeu, bool *depCaisse, int *depX, int *depY)
-{
-    char deplacement = jeu->deplacements.liste[jeu->deplacements.nbDeplacements-1];
+void gerer_gagner(t_partie *jeu){
+    afficher_encadre("Vous avez gagner !");
+    noter_evenement(jeu->enregistrement, EVENEMENT_VICTOIRE,
+        jeu->moteur.deplacements.nbDeplacements);
+    printf(
+        "Il vous a fallu %d déplacements et %d tentative(s) pour finir ce niveau.",
+        jeu->moteur.deplacements.nbDeplacements, jeu->tentatives);
+
+    printf("\n\n");
+    noter_victoire(jeu);
+    printf("\n\n");
 
-    // Si le déplacement est une majuscule alors c'est qu'on bouge une caisse
-    if(isupper(deplacement)){
-        *depCaisse = true;
+    if(demarrer_partie(jeu)){
+        demarrer_niveau(&jeu->moteur);
     }
+}
 
-    // Mettre en minuscule pour récupérer juste l'axe de déplacement
-    switch(tolower(deplacement)){
-        case DEP_SOK_GAU:
-            *depY = 1;
-            break;
-        case DEP_SOK_HAU:
-            *depX = 1;
-            break;
-        case DEP_SOK_BAS:
-            *depX = -1;
-            break;
-        case DEP_SOK_DRO:
-            *depY = -1;
-            break;
+/**
+*
+* @brief Compter les poussées de la partie (majuscules de la liste)
+* @param moteur de type t_moteur, Entrée : état de la partie
+* @return entier : nombre de poussées
+*
+*/
+int compter_poussees(t_moteur *moteur){
+    int nbPoussees = 0;
+
+    for(int i = 0 ; i < moteur->deplacements.nbDeplacements ; i++){
+        nbPoussees += isupper(moteur->deplacements.liste[i]) != 0;
     }
 
-    jeu->deplacements.nbDeplacements--;
+    return nbPoussees;
 }
 
-
 /**
 *
-* @brief Revenir à l'action précédente
+* @brief Enregistrer la victoire dans les statistiques et afficher les
+*   records du niveau
 * @param jeu de type t_partie, Entrée/Sortie : structure de la partie
 *
 */
-void retour_arriere(t_partie *jeu){
-
-    int depX = 0;
-    int depY = 0;
-    bool depCaisse = false;
+void noter_victoire(t_partie *jeu){
+    t_victoire victoire;
+    t_plateau depart;
+    const char *joueur = getenv("USER");
+
+    // charger_partie arrête le programme si le fichier n'existe plus
+    if(access(jeu->nomFichier, R_OK) == 0){
+        charger_partie(depart, jeu->nomFichier);
+        memset(&victoire, 0, sizeof(t_victoire));
+        victoire.empreinte = empreinte_niveau(depart);
+        strncpy(victoire.joueur, joueur != NULL ? joueur : JOUEUR_INCONNU,
+            TAILLE_JOUEUR - 1);
+        victoire.nbDeplacements = jeu->moteur.deplacements.nbDeplacements;
+        victoire.nbPoussees = compter_poussees(&jeu->moteur);
+        victoire.duree = (lire_horloge() - jeu->debutTentative) / 1000000;
+        victoire.tentatives = jeu->tentatives;
+        victoire.date = time(NULL);
+
+        printf("Votre partie : %d poussée(s) en %.1f s\n",
+            victoire.nbPoussees, victoire.duree / 1000.0);
+        enregistrer_victoire(&jeu->scores, &victoire);
+        afficher_records(consulter_scores(&jeu->scores,
+            victoire.empreinte));
+    }
+}
 
-    // Récupérer axe déplacement et si on bouge une caisse
-    recuperer_deplacement(jeu, &depCaisse, &depX, &depY);
+/**
+*
+* @brief Afficher les records et le classement d'un niveau
+* @param stats de type t_statsNiveau, Entrée : statistiques du niveau
+*   (NULL s'il n'a jamais été gagné)
+*
+*/
+void afficher_records(t_statsNiveau *stats){
+    t_victoire *partie;
 
-    char *positionJoueur = &jeu->plateau[jeu->joueur.posX][jeu->joueur.posY];
-    char *positionApres =
-        &jeu->plateau[jeu->joueur.posX+depX][jeu->joueur.posY+depY];
-    char *positionAvant =
-        &jeu->plateau[jeu->joueur.posX-depX][jeu->joueur.posY-depY];
+    if(stats == NULL){
+        printf("Ce niveau n'a encore jamais été gagné.\n");
+    }
+    else{
+        printf("Records (%d victoire(s)) : %d déplacements, %d poussées, "
+            "%.1f s, %d tentative(s)\n", stats->nbVictoires,
+            stats->meilleursDeplacements, stats->meilleuresPoussees,
+            stats->meilleureDuree / 1000.0, stats->moinsTentatives);
+        printf("Classement :\n");
+        for(int i = 0 ; i < stats->nbClasses ; i++){
+            partie = &stats->classement[i];
+            printf("  %d. %-15s %4d déplacements, %4d poussées, %.1f s\n",
+                i + 1, partie->joueur, partie->nbDeplacements,
+                partie->nbPoussees, partie->duree / 1000.0);
+        }
+    }
+}
 
-    /* Déplacer le joueur */
+/**
+*
+* @brief Attendre une touche sans occuper le processeur : jusqu'à l'image
+*   suivante si l'affichage est en retard, le temps d'une image si une
+*   vérification est en cours, ATTENTE_MAX_MS sinon (SIGWINCH interrompt
+*   aussi l'attente)
+* @param jeu de type t_partie, Entrée : structure de la partie
+*
+*/
+void attendre_evenement(t_partie *jeu){
+    struct pollfd entree = {STDIN_FILENO, POLLIN, 0};
+    struct termios ancien, attente;
+    long delaiMs = ATTENTE_MAX_MS;
 
-    // Si la position suivante est une cible on met un joueur sur une cible
-    if(*positionApres == CIBLE){
-        *positionApres = PLAYER_SUR_CIBLE;
+    if(jeu->imageEnRetard){
+        delaiMs = (INTERVALLE_IMAGE - (lire_horloge() - jeu->derniereImage) +
+            999999) / 1000000;
     }
-    else{
-        *positionApres = PLAYER;
+    else if(jeu->verificationEnCours){
+        delaiMs = INTERVALLE_IMAGE / 1000000;
     }
 
-    if(depCaisse){
-        // Si la position ou va aller la caisse est une cible on met
-        // une caisse sur une cible
-        if(*positionJoueur == PLAYER_SUR_CIBLE || *positionJoueur == CIBLE){
-            *positionJoueur = CAISSE_SUR_CIBLE;
+    if(delaiMs > 0){
+        // Hors du mode canonique, une seule touche réveille poll
+        tcgetattr(STDIN_FILENO, &ancien);
+        attente = ancien;
+        attente.c_lflag &= ~(ICANON | ECHO);
+        tcsetattr(STDIN_FILENO, TCSANOW, &attente);
+        poll(&entree, 1, delaiMs);
+        tcsetattr(STDIN_FILENO, TCSANOW, &ancien);
+    }
+}
+
+/**
+*
+* @brief Jouer jusqu'à la fin : touches, redimensionnement du terminal et
+*   verdict de la vérification en arrière-plan
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*
+*/
+void boucle_jeu(t_partie *jeu){
+    while(!jeu->estFinis)
+    {
+        if (kbhit()){
+            jouer_touches_en_attente(jeu);
         }
-        else{
-            *positionJoueur = CAISSE;
+        else if(tailleTerminalChangee){
+            tailleTerminalChangee = 0;
+            lire_taille_terminal(&jeu->vue);
+            jeu->imageEnRetard = true;
         }
-        
-        if(*positionAvant == CAISSE_SUR_CIBLE){
-            *positionAvant = CIBLE;
+        else if(suivre_resolubilite(jeu)){
+            // Le verdict est arrivé sans que le joueur ait bougé
+            jeu->imageEnRetard = true;
         }
         else{
-            *positionAvant = VIDE;
+            attendre_evenement(jeu);
+        }
+
+        // Au plus IMAGES_PAR_SECONDE images par seconde
+        if(jeu->imageEnRetard && !jeu->estFinis &&
+            lire_horloge() - jeu->derniereImage >= INTERVALLE_IMAGE){
+            rafraichir_affichage(jeu);
         }
     }
+}
 
-    else{
-        if(*positionJoueur == PLAYER_SUR_CIBLE){
-            *positionJoueur = CIBLE;
+/**
+*
+* @brief Oublier ce qui concernait le niveau précédent (niveau chargé)
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*
+*/
+void preparer_niveau(t_partie *jeu){
+    t_plateau depart;
+
+    // Plateau du fichier : des déplacements repris y ont peut-être été joués
+    if(jeu->enregistrement != NULL){
+        charger_partie(depart, jeu->nomFichier);
+        noter_niveau(jeu->enregistrement, jeu->nomFichier, depart,
+            jeu->moteur.deplacements.liste,
+            jeu->moteur.deplacements.nbDeplacements);
+    }
+    jeu->tentatives = 1;
+    jeu->debutTentative = lire_horloge();
+    jeu->coupBloquant = -1;
+    jeu->coupConseil = -1;
+    oublier_conseil(&jeu->conseil);
+
+    // Nouveau niveau : la vue est recentrée sur le joueur
+    jeu->vue.nbLignes = 0;
+}
+
+/**
+*
+* @brief Lire les options de la ligne de commande
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @param arguments de type t_arguments, Sortie : options lues
+* @return vrai si les options sont valides
+*
+*/
+bool lire_arguments(int argc, char *argv[], t_arguments *arguments){
+    bool valides = true;
+    bool sansValeur;
+    bool sansClavier;
+    int i = 1;
+
+    memset(arguments, 0, sizeof(t_arguments));
+    arguments->index = 1;
+    while(i < argc && valides){
+        // --sans-affichage et --scores sont les seules options sans valeur
+        sansValeur = strcmp(argv[i], "--sans-affichage") == 0 ||
+            strcmp(argv[i], "--scores") == 0;
+        valides = i + 1 < argc || sansValeur;
+        if(sansValeur){
+            arguments->scores |= strcmp(argv[i], "--scores") == 0;
+            arguments->sansAffichage |= strcmp(argv[i], "--scores") != 0;
+            i--;
+        }
+        else if(valides && strcmp(argv[i], "--niveau") == 0){
+            valides = strlen(argv[i + 1]) < TAILLE_NOM_FICHIER;
+            strncpy(arguments->niveau, argv[i + 1], TAILLE_NOM_FICHIER - 1);
+        }
+        else if(valides && strcmp(argv[i], "--pack") == 0){
+            arguments->pack = argv[i + 1];
+        }
+        else if(valides && strcmp(argv[i], "--index") == 0){
+            arguments->index = atoi(argv[i + 1]);
+        }
+        else if(valides && strcmp(argv[i], "--deplacements") == 0){
+            arguments->deplacements = argv[i + 1];
+        }
+        else if(valides && strcmp(argv[i], "--sortie") == 0){
+            arguments->sortie = argv[i + 1];
+        }
+        else if(valides && strcmp(argv[i], "--enregistrer") == 0){
+            arguments->enregistrement = argv[i + 1];
+        }
+        else if(valides && strcmp(argv[i], "--rejouer") == 0){
+            arguments->rejeu = argv[i + 1];
         }
         else{
-            *positionJoueur = VIDE;
+            valides = false;
         }
+        i += 2;
     }
 
-    jeu->joueur.posX += depX;
-    jeu->joueur.posY += depY;
+    if(valides && arguments->pack != NULL){
+        valides = choisir_dans_pack(arguments);
+    }
+    // Sans affichage, aucun fichier ne peut être demandé au joueur, et
+    // seule une partie jouée au clavier est enregistrée
+    sansClavier = arguments->sansAffichage || arguments->scores;
+    return valides && (!sansClavier || arguments->niveau[0] != '\0') &&
+        (arguments->enregistrement == NULL ||
+        (!sansClavier && arguments->rejeu == NULL));
 }
 
 /**
 *
-* @brief Définir les valeurs de la partie par défaut
-* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
+* @brief Afficher les options de la ligne de commande
+* @param programme de type chaîne de caractères, Entrée : nom du programme
 *
 */
-void initialiser_jeu(t_partie *jeu){
-    jeu->deplacements.nbDeplacements = 0;
-    jeu->estFinis = false;
-    jeu->zoom = ZOOM_MIN;
-    jeu->tentatives  = 1;
+void afficher_utilisation(char programme[]){
+    printf("Utilisation : %s [--niveau fichier.sok | --pack dossier "
+        "[--index n]]\n", programme);
+    printf("              [--deplacements fichier.dep] "
+        "[--sortie fichier.sok]\n");
+    printf("              [--sans-affichage | --scores | "
+        "--enregistrer session.skr]\n");
+    printf("       %s --rejouer session.skr\n", programme);
+    printf("Sans affichage, les déplacements sont joués sans question ; "
+        "code de sortie 0 si\nle niveau est gagné, %d sinon.\n",
+        SORTIE_NON_GAGNE);
+    printf("--scores affiche les records et le classement du niveau, sans "
+        "jouer.\n");
+    printf("--rejouer rejoue une session enregistrée et affiche le bilan de "
+        "chaque niveau.\n");
 }
 
 /**
 *
-* @brief Récupérer le nombre de lignes vraiment utiles à l'affichage
-*  du plateau
-* @return entier : nombre de lignes utiles
+* @brief Reconnaître un fichier de niveau (filtre de scandir)
+* @param entree de type struct dirent, Entrée : entrée du dossier
+* @return entier : 1 si le nom se termine par .sok, 0 sinon
+*
 */
-int recuperer_lignes_utiles(t_partie jeu){
-    int lignesAAfficher = TAILLE;
-    int ligne = TAILLE - 1;
-    int colonne = 0;
-    bool finAtteinte = false;
-    bool ligneVide;
-
-    while(!finAtteinte && ligne >= 0){
-        ligneVide = true;
-        while(!finAtteinte && colonne < TAILLE){
-            if(jeu.plateau[ligne][colonne] != VIDE){
-                finAtteinte = true;
-                ligneVide = false;
-            }
-            colonne++;
-        }
+int est_niveau(const struct dirent *entree){
+    int longueur = strlen(entree->d_name);
 
-        if(ligneVide){
-            lignesAAfficher--;
-        }
+    return longueur > 4 && strcmp(&entree->d_name[longueur - 4], ".sok") == 0;
+}
+
+/**
+*
+* @brief Choisir le niveau numéro index du pack (fichiers .sok du dossier,
+*   dans l'ordre alphabétique)
+* @param arguments de type t_arguments, Entrée/Sortie : options, le
+*   niveau choisi est rempli
+* @return vrai si le pack contient ce niveau
+*
+*/
+bool choisir_dans_pack(t_arguments *arguments){
+    struct dirent **entrees;
+    int nbEntrees = scandir(arguments->pack, &entrees, est_niveau, alphasort);
+    bool trouve = arguments->index >= 1 && arguments->index <= nbEntrees;
 
-        colonne = 0;
-        ligne--;
+    if(trouve){
+        // Un chemin trop long ne peut pas être gardé
+        trouve = snprintf(arguments->niveau, TAILLE_NOM_FICHIER, "%s/%s",
+            arguments->pack, entrees[arguments->index - 1]->d_name) <
+            TAILLE_NOM_FICHIER;
+    }
+    if(!trouve){
+        printf("Pas de niveau n°%d dans %s (%d niveau(x))\n",
+            arguments->index, arguments->pack, nbEntrees < 0 ? 0 : nbEntrees);
     }
 
-    return lignesAAfficher;
+    for(int i = 0 ; i < nbEntrees ; i++){
+        free(entrees[i]);
+    }
+    if(nbEntrees >= 0){
+        free(entrees);
+    }
+
+    return trouve;
 }
 
 /**
 *
-* @brief Afficher la victoire et gérer le redémarrage
-* @param plateau de type t_partie, Entrée/Sortie : structure de la partie
+* @brief Charger le niveau des options et y jouer le fichier de
+*   déplacements, s'il est donné
+* @param arguments de type t_arguments, Entrée : options
+* @param moteur de type t_moteur, Sortie : état de la partie
+* @return entier : nombre de déplacements joués, -1 si un fichier ne peut
+*   pas être lu
 *
 */
-void gerer_gagner(t_partie *jeu){
-    afficher_encadre("Vous avez gagner !");
-    printf(
-        "Il vous a fallu %d déplacements et %d tentative(s) pour finir ce niveau.",
-        jeu->deplacements.nbDeplacements, jeu->tentatives);
+int charger_arguments(t_arguments *arguments, t_moteur *moteur){
+    t_tabDeplacement codes;
+    int nbCodes = 0;
+    int nbJoues = -1;
+    FILE *fichier = NULL;
+    // charger_partie arrête le programme si le fichier n'existe pas
+    bool lisibles = access(arguments->niveau, R_OK) == 0;
+
+    if(lisibles && arguments->deplacements != NULL){
+        fichier = fopen(arguments->deplacements, "r");
+        lisibles = fichier != NULL;
+    }
+
+    if(lisibles){
+        if(fichier != NULL){
+            nbCodes = fread(codes, sizeof(char), MAX_DEP, fichier);
+            fclose(fichier);
+        }
+        charger_niveau(moteur, arguments->niveau);
+        nbJoues = jouer_deplacements(moteur, codes, nbCodes);
+    }
+    else{
+        printf("Impossible de lire %s\n", access(arguments->niveau, R_OK) ?
+            arguments->niveau : arguments->deplacements);
+    }
 
-    printf("\n\n\n");
+    return nbJoues;
+}
 
-    if(demarrer_partie(jeu)){
-        jeu->deplacements.nbDeplacements = 0;
-        position_joueur(jeu); 
+/**
+*
+* @brief Commencer la partie sur le niveau des options, sans question
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+* @param arguments de type t_arguments, Entrée : options
+* @return vrai si la partie a commencé
+*
+*/
+bool commencer_niveau_arguments(t_partie *jeu, t_arguments *arguments){
+    bool commencee = charger_arguments(arguments, &jeu->moteur) >= 0;
+
+    if(commencee){
+        strcpy(jeu->nomFichier, arguments->niveau);
+        preparer_niveau(jeu);
+        rafraichir_affichage(jeu);
+    }
+    else{
+        jeu->estFinis = true;
     }
-}
 
-/* Fonctions fournies */
+    return commencee;
+}
 
-void charger_partie(t_plateau plateau, char fichier[]){
-    FILE * f;
-    char finDeLigne;
-
-    f = fopen(fichier, "r");
-    if (f==NULL){
-        printf("ERREUR SUR FICHIER");
-        exit(EXIT_FAILURE);
-    } else {
-        for (int ligne = 0 ; ligne < TAILLE ; ligne++){
-            for (int colonne = 0 ; colonne < TAILLE ; colonne++){
-                fread(&plateau[ligne][colonne], sizeof(char), 1, f);
-            }
-            fread(&finDeLigne, sizeof(char), 1, f);
+/**
+*
+* @brief Jouer les déplacements des options sans terminal (ni base de
+*   motifs, ni vérification en arrière-plan) et afficher le résultat
+* @param arguments de type t_arguments, Entrée : options
+* @return entier : code de sortie (0 : gagné, SORTIE_NON_GAGNE : pas
+*   gagné, EXIT_FAILURE : fichier illisible)
+*
+*/
+int jouer_sans_affichage(t_arguments *arguments){
+    t_moteur moteur;
+    int nbJoues = charger_arguments(arguments, &moteur);
+    int code = EXIT_FAILURE;
+    bool victoire;
+
+    if(nbJoues >= 0){
+        victoire = gagne(&moteur);
+        if(arguments->sortie != NULL){
+            enregistrer_partie(moteur.plateau, arguments->sortie);
         }
-        fclose(f);
+        printf("%s : %s, %d déplacement(s) joué(s)\n", arguments->niveau,
+            victoire ? "gagné" : "pas gagné", nbJoues);
+        code = victoire ? EXIT_SUCCESS : SORTIE_NON_GAGNE;
     }
-}
 
-void enregistrer_partie(t_plateau plateau, char fichier[]){
-    FILE * f;
-    char finDeLigne = '\n';
+    return code;
+}
 
-    f = fopen(fichier, "w");
-    for (int ligne=0 ; ligne<TAILLE ; ligne++){
-        for (int colonne=0 ; colonne<TAILLE ; colonne++){
-            fwrite(&plateau[ligne][colonne], sizeof(char), 1, f);
-        }
-        fwrite(&finDeLigne, sizeof(char), 1, f);
+/**
+*
+* @brief Afficher les records du niveau des options, sans jouer
+* @param arguments de type t_arguments, Entrée : options
+* @return entier : code de sortie (EXIT_FAILURE : fichier illisible)
+*
+*/
+int afficher_scores_niveau(t_arguments *arguments){
+    t_scores scores;
+    t_plateau depart;
+    int code = EXIT_FAILURE;
+
+    if(access(arguments->niveau, R_OK) == 0){
+        charger_partie(depart, arguments->niveau);
+        ouvrir_scores(FICHIER_SCORES, &scores);
+        printf("%s\n", arguments->niveau);
+        afficher_records(consulter_scores(&scores,
+            empreinte_niveau(depart)));
+        fermer_scores(&scores);
+        code = EXIT_SUCCESS;
+    }
+    else{
+        printf("Impossible de lire %s\n", arguments->niveau);
     }
-    fclose(f);
+
+    return code;
 }
 
+/* Fonctions fournies */
+
 int kbhit(){
 	// la fonction retourne :
 	// 1 si un caractere est present
@@ -854,11 +980,3 @@ int kbhit(){
 	} 
 	return unCaractere;
 }
-
-void enregistrer_deplacements(t_tabDeplacement t, int nb, char fic[]){
-    FILE * f;
-
-    f = fopen(fic, "w");
-    fwrite(t,sizeof(char), nb, f);
-    fclose(f);
-}
\ No newline at end of file
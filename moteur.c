@@ -0,0 +1,485 @@
+/**
+* @file moteur.c
+* @brief Moteur du jeu : déplacements, poussées, annulation et victoire
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Fonctions reprises du jeu (partie.c) ; les anciennes copies de la première
+* version et de la version animée ont été retirées.
+*/
+
+#include <stdbool.h>
+#include <ctype.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+
+/* Fonctions internes */
+
+void gestion_deplacement_caisse(char *positionSuivante,
+    char *positionApresSuivante, t_moteur *moteur);
+void stocker_deplacement(t_moteur *moteur, int depX, int depY, int type);
+void recuperer_deplacement(t_moteur *moteur, bool *depCaisse, int *depX,
+    int *depY);
+char contenu_case(t_moteur *moteur, int ligne, int colonne);
+bool case_bloquee(t_moteur *moteur, int ligne, int colonne);
+bool dans_couloir(t_moteur *moteur, int ligne, int colonne, int depX,
+    int depY);
+
+/**
+*
+* @brief Charger un niveau et commencer la partie
+* @param moteur de type t_moteur, Sortie : état de la partie
+* @param fichier de type chaîne de caractères, Entrée : fichier .sok
+*/
+void charger_niveau(t_moteur *moteur, char fichier[])
+{
+    charger_partie(moteur->plateau, fichier);
+    demarrer_niveau(moteur);
+}
+
+/**
+*
+* @brief Commencer la partie sur le plateau déjà rempli (aucun
+*   déplacement, joueur retrouvé)
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+*/
+void demarrer_niveau(t_moteur *moteur)
+{
+    moteur->deplacements.nbDeplacements = 0;
+    position_joueur(moteur);
+}
+
+/**
+*
+* @brief Récupérer la position x et y du joueur
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+*
+*/
+void position_joueur(t_moteur *moteur)
+{
+    bool joueurTrouve = false;
+    int ligne = 0;
+    int colonne = 0;
+
+    while(!joueurTrouve && ligne < TAILLE){
+        while(!joueurTrouve && colonne < TAILLE){
+            if(moteur->plateau[ligne][colonne] == PLAYER ||
+                moteur->plateau[ligne][colonne] == PLAYER_SUR_CIBLE){
+                moteur->joueur.posX = ligne;
+                moteur->joueur.posY = colonne;
+                joueurTrouve = true;
+            }
+            colonne++;
+        }
+        colonne = 0;
+        ligne++;
+    }
+}
+
+/**
+*
+* @brief Savoir si la partie est gagnée
+* @param moteur de type t_moteur, Entrée : état de la partie
+* @return vrai si la partie est gagnée sinon faux
+*/
+bool gagne(t_moteur *moteur)
+{
+    bool aGagner = true;
+
+    for (int ligne = 0 ; ligne < TAILLE ; ligne++){
+        for (int colonne = 0 ; colonne < TAILLE ; colonne++){
+            // Si y a encore une cible ou qu'un joueur est sur une cible pas
+            // encore gagné
+            if(
+                moteur->plateau[ligne][colonne] == CIBLE ||
+                moteur->plateau[ligne][colonne] == PLAYER_SUR_CIBLE
+            ){
+                aGagner = false;
+            }
+        }
+    }
+
+    return aGagner;
+}
+
+/**
+*
+* @brief Gérer le déplacement d'une caisse
+* @param positionSuivante de type t_plateau, Entrée : position après le joueur
+* @param positionApresSuivante de type entier, Entrée : position encore après
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+*/
+void gestion_deplacement_caisse(char *positionSuivante,
+    char *positionApresSuivante, t_moteur *moteur){
+
+    // Déplacer la caisse et si c'est une cible on met une caisse sur une cible
+    if(*positionApresSuivante == CIBLE){
+        *positionApresSuivante = CAISSE_SUR_CIBLE;
+    }
+    else{
+        *positionApresSuivante = CAISSE;
+    }
+
+    // Déplacer le joueur et si c'est une cible ou une caisse sur une cible,
+    //on met le joueur sur une cible sinon on met juste un joueur
+    if(*positionSuivante == CIBLE || *positionSuivante == CAISSE_SUR_CIBLE){
+        *positionSuivante = PLAYER_SUR_CIBLE;
+    }
+    else{
+        *positionSuivante = PLAYER;
+    }
+
+    // Si le joueur est sur une cible on la remet
+    if(moteur->plateau[moteur->joueur.posX][moteur->joueur.posY] ==
+        PLAYER_SUR_CIBLE){
+        moteur->plateau[moteur->joueur.posX][moteur->joueur.posY] = CIBLE;
+    }
+    else
+    {
+        moteur->plateau[moteur->joueur.posX][moteur->joueur.posY] = VIDE;
+    }
+}
+
+/**
+*
+* @brief Faire se déplacer le joueur
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @param depX de type entier, Entrée : déplacement vertical
+* @param depY de type entier, Entrée : déplacement horizontal
+* @return t_resultatDeplacement : déplacement fait (ou non)
+* Rien ne bouge quand la liste des déplacements est pleine
+*/
+t_resultatDeplacement deplacer(t_moteur *moteur, int depX, int depY)
+{
+    t_joueur *joueur = &moteur->joueur;
+    t_resultatDeplacement resultat = DEPLACEMENT_IMPOSSIBLE;
+    int ligne = joueur->posX + depX;
+    int colonne = joueur->posY + depY;
+    // Hors du plateau, une case compte comme un mur
+    char apresSuivante = contenu_case(moteur, ligne + depX, colonne + depY);
+    char *positionSuivante;
+
+    // Si on est pas contre un bord et qu'on ne sort pas du plateau
+    if(contenu_case(moteur, ligne, colonne) != MUR &&
+        moteur->deplacements.nbDeplacements < MAX_DEP)
+    {
+        positionSuivante = &moteur->plateau[ligne][colonne];
+        // Si on ne pousse pas de caisse
+        if(*positionSuivante != CAISSE && *positionSuivante != CAISSE_SUR_CIBLE)
+        {
+            // Si la position suivante est une cible
+            //on ajoute un joueur sur la cible sinon on met juste un joueur
+            if(*positionSuivante == CIBLE)
+            {
+                *positionSuivante = PLAYER_SUR_CIBLE;
+            }
+            else{
+                *positionSuivante = PLAYER;
+            }
+
+            // Si le joueur est sur une cible on la remet sinon on met du vide
+            if(moteur->plateau[joueur->posX][joueur->posY] ==
+                PLAYER_SUR_CIBLE){
+                moteur->plateau[joueur->posX][joueur->posY] = CIBLE;
+            }
+            else
+            {
+                moteur->plateau[joueur->posX][joueur->posY] = VIDE;
+            }
+
+            resultat = DEPLACEMENT_SIMPLE;
+        }
+        // Sinon on tente de pousser une caisse mais on vérifie que la case
+        // derrière n'est pas un mur ou une autre caisse
+        else if(
+            apresSuivante != MUR &&
+            apresSuivante != CAISSE &&
+            apresSuivante != CAISSE_SUR_CIBLE
+        ){
+            gestion_deplacement_caisse(positionSuivante,
+                &moteur->plateau[ligne + depX][colonne + depY], moteur);
+            resultat = DEPLACEMENT_POUSSEE;
+        }
+    }
+
+    if(resultat != DEPLACEMENT_IMPOSSIBLE){
+        stocker_deplacement(moteur, depX, depY,
+            resultat == DEPLACEMENT_POUSSEE);
+        joueur->posX += depX;
+        joueur->posY += depY;
+    }
+
+    return resultat;
+}
+
+/**
+*
+* @brief Lire le contenu d'une case, un mur si elle est hors du plateau
+* @param moteur de type t_moteur, Entrée : état de la partie
+* @param ligne de type entier, Entrée : ligne de la case
+* @param colonne de type entier, Entrée : colonne de la case
+* @return caractère : contenu de la case
+*/
+char contenu_case(t_moteur *moteur, int ligne, int colonne)
+{
+    char contenu = MUR;
+
+    if(ligne >= 0 && ligne < TAILLE && colonne >= 0 && colonne < TAILLE){
+        contenu = moteur->plateau[ligne][colonne];
+    }
+
+    return contenu;
+}
+
+/**
+*
+* @brief Savoir si une case est un mur ou hors du plateau
+* @param moteur de type t_moteur, Entrée : état de la partie
+* @param ligne de type entier, Entrée : ligne de la case
+* @param colonne de type entier, Entrée : colonne de la case
+* @return vrai si le joueur ne peut pas aller sur la case
+*/
+bool case_bloquee(t_moteur *moteur, int ligne, int colonne)
+{
+    return contenu_case(moteur, ligne, colonne) == MUR;
+}
+
+/**
+*
+* @brief Savoir si une case est dans un couloir de largeur 1 dans le sens
+*   d'un déplacement (murs des deux côtés)
+* @param moteur de type t_moteur, Entrée : état de la partie
+* @param ligne de type entier, Entrée : ligne de la case
+* @param colonne de type entier, Entrée : colonne de la case
+* @param depX de type entier, Entrée : déplacement vertical
+* @param depY de type entier, Entrée : déplacement horizontal
+* @return vrai si la case est bordée de murs perpendiculairement
+*/
+bool dans_couloir(t_moteur *moteur, int ligne, int colonne, int depX,
+    int depY)
+{
+    return case_bloquee(moteur, ligne + depY, colonne + depX) &&
+        case_bloquee(moteur, ligne - depY, colonne - depX);
+}
+
+/**
+*
+* @brief Continuer de pousser la dernière caisse poussée tant qu'elle est
+*   dans un couloir sans cible (elle ne peut rien faire d'autre)
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @return entier : nombre de poussées faites
+*/
+int traverser_couloir(t_moteur *moteur)
+{
+    int depX = 0;
+    int depY = 0;
+    int nbDeplacements = moteur->deplacements.nbDeplacements;
+    int nbPoussees = 0;
+    bool continuer = nbDeplacements > 0 &&
+        isupper(moteur->deplacements.liste[nbDeplacements - 1]);
+
+    if(continuer){
+        switch(tolower(moteur->deplacements.liste[nbDeplacements - 1])){
+            case DEP_SOK_GAU:
+                depY = -1;
+                break;
+            case DEP_SOK_HAU:
+                depX = -1;
+                break;
+            case DEP_SOK_BAS:
+                depX = 1;
+                break;
+            case DEP_SOK_DRO:
+                depY = 1;
+                break;
+        }
+    }
+
+    // Chaque poussée est enregistrée : on peut les annuler une par une
+    while(continuer){
+        continuer = contenu_case(moteur, moteur->joueur.posX + depX,
+            moteur->joueur.posY + depY) == CAISSE &&
+            dans_couloir(moteur, moteur->joueur.posX, moteur->joueur.posY,
+                depX, depY) &&
+            dans_couloir(moteur, moteur->joueur.posX + depX,
+                moteur->joueur.posY + depY, depX, depY);
+
+        if(continuer){
+            continuer = deplacer(moteur, depX, depY) == DEPLACEMENT_POUSSEE;
+            nbPoussees += continuer;
+        }
+    }
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Stocker les déplacements dans le tableau
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @param depX de type entier, Entrée : Indice de déplacement x
+* @param depY de type entier, Entrée : Indice de déplacement y
+* @param type de type entier, Entrée : Type de déplacement
+* 0 = joueur simple, 1 = joueur et caisse
+*/
+void stocker_deplacement(t_moteur *moteur, int depX, int depY, int type){
+    t_deplacements *deplacements = &moteur->deplacements;
+
+    if(depX == -1 && depY == 0){
+        // syntaxe raccourcie de if pour la val d'une variable
+        // x = a ? b : c
+        // si a : x = b sinon x = c
+        deplacements->liste[deplacements->nbDeplacements] =
+            type ? DEP_SOK_CAI_H : DEP_SOK_HAU;
+    }
+    else if(depX == 0 && depY == -1){
+        deplacements->liste[deplacements->nbDeplacements] =
+            type ? DEP_SOK_CAI_G : DEP_SOK_GAU;
+    }
+    else if(depX == 1 && depY == 0){
+        deplacements->liste[deplacements->nbDeplacements] =
+            type ? DEP_SOK_CAI_B : DEP_SOK_BAS;
+    }
+    else{
+        deplacements->liste[deplacements->nbDeplacements] =
+            type ? DEP_SOK_CAI_D : DEP_SOK_DRO;
+    }
+
+    deplacements->nbDeplacements++;
+}
+
+/**
+*
+* @brief Renvoyer le type de déplacement pour le retour arrière
+*   (coordonnées + si c'est une caisse)
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @param depCaisse de type booléen, Entrée/Sortie : si on déplace une caisse
+* @param depX de type entier, Entrée/Sortie : déplacement axe x
+* @param depY de type entier, Entrée/Sortie : déplacement axe y
+*
+*/
+void recuperer_deplacement(t_moteur *moteur, bool *depCaisse, int *depX,
+    int *depY)
+{
+    char deplacement =
+        moteur->deplacements.liste[moteur->deplacements.nbDeplacements-1];
+
+    // Si le déplacement est une majuscule alors c'est qu'on bouge une caisse
+    if(isupper(deplacement)){
+        *depCaisse = true;
+    }
+
+    // Mettre en minuscule pour récupérer juste l'axe de déplacement
+    switch(tolower(deplacement)){
+        case DEP_SOK_GAU:
+            *depY = 1;
+            break;
+        case DEP_SOK_HAU:
+            *depX = 1;
+            break;
+        case DEP_SOK_BAS:
+            *depX = -1;
+            break;
+        case DEP_SOK_DRO:
+            *depY = -1;
+            break;
+    }
+
+    moteur->deplacements.nbDeplacements--;
+}
+
+/**
+*
+* @brief Revenir à l'action précédente
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @return vrai si un déplacement a été annulé (faux si aucun n'est noté)
+*
+*/
+bool retour_arriere(t_moteur *moteur){
+
+    int depX = 0;
+    int depY = 0;
+    bool depCaisse = false;
+    bool annule = moteur->deplacements.nbDeplacements > 0;
+    char *positionJoueur, *positionApres, *positionAvant;
+
+    if(annule){
+        // Récupérer axe déplacement et si on bouge une caisse
+        recuperer_deplacement(moteur, &depCaisse, &depX, &depY);
+
+        positionJoueur =
+            &moteur->plateau[moteur->joueur.posX][moteur->joueur.posY];
+        positionApres = &moteur->plateau[moteur->joueur.posX+depX]
+            [moteur->joueur.posY+depY];
+        positionAvant = &moteur->plateau[moteur->joueur.posX-depX]
+            [moteur->joueur.posY-depY];
+
+        /* Déplacer le joueur */
+
+        // Si la position suivante est une cible on met un joueur sur une
+        // cible
+        *positionApres = *positionApres == CIBLE ? PLAYER_SUR_CIBLE : PLAYER;
+
+        if(depCaisse){
+            // Si la position ou va aller la caisse est une cible on met
+            // une caisse sur une cible
+            *positionJoueur = *positionJoueur == PLAYER_SUR_CIBLE ?
+                CAISSE_SUR_CIBLE : CAISSE;
+            *positionAvant = *positionAvant == CAISSE_SUR_CIBLE ?
+                CIBLE : VIDE;
+        }
+        else{
+            *positionJoueur = *positionJoueur == PLAYER_SUR_CIBLE ?
+                CIBLE : VIDE;
+        }
+
+        moteur->joueur.posX += depX;
+        moteur->joueur.posY += depY;
+    }
+
+    return annule;
+}
+
+/**
+*
+* @brief Jouer des déplacements au format des fichiers .dep (les
+*   déplacements impossibles et les caractères inconnus sont ignorés,
+*   comme dans le jeu)
+* @param moteur de type t_moteur, Entrée/Sortie : état de la partie
+* @param codes de type chaîne de caractères, Entrée : déplacements (la
+*   casse est ignorée : le moteur décide s'il y a poussée)
+* @param nbCodes de type entier, Entrée : nombre de déplacements
+* @return entier : nombre de déplacements joués
+*/
+int jouer_deplacements(t_moteur *moteur, const char codes[], int nbCodes)
+{
+    int nbJoues = 0;
+    int depX, depY;
+
+    for(int i = 0 ; i < nbCodes ; i++){
+        depX = 0;
+        depY = 0;
+        switch(tolower(codes[i])){
+            case DEP_SOK_HAU:
+                depX = -1;
+                break;
+            case DEP_SOK_BAS:
+                depX = 1;
+                break;
+            case DEP_SOK_GAU:
+                depY = -1;
+                break;
+            case DEP_SOK_DRO:
+                depY = 1;
+                break;
+        }
+        if((depX != 0 || depY != 0) &&
+            deplacer(moteur, depX, depY) != DEPLACEMENT_IMPOSSIBLE){
+            nbJoues++;
+        }
+    }
+
+    return nbJoues;
+}
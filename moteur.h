@@ -0,0 +1,59 @@
+/**
+* @file moteur.h
+* @brief Moteur du jeu : déplacements, poussées, annulation et victoire
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le moteur n'affiche rien et ne lit pas le clavier : les jeux dans le
+* terminal (main.c, Sokoban_V1_CHARPENTIER_Liam.c, animations.c) et les
+* outils l'utilisent tous. Avec fichiers.c, il forme la bibliothèque
+* libsokoban (make lib : bin/libsokoban.a et bin/libsokoban.so).
+*
+* Le plateau est celui des fichiers .sok ; chaque déplacement réussi est
+* noté dans la liste au format des fichiers .dep (majuscule : poussée).
+*/
+
+#ifndef MOTEUR_H
+#define MOTEUR_H
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+
+// Résultat d'un déplacement
+typedef enum {
+    DEPLACEMENT_IMPOSSIBLE, // mur, caisse bloquée ou liste pleine
+    DEPLACEMENT_SIMPLE,
+    DEPLACEMENT_POUSSEE
+} t_resultatDeplacement;
+
+// Structure déplacements
+typedef struct {
+    t_tabDeplacement liste; // liste des déplacements (pour stocker et undo)
+    int nbDeplacements;
+} t_deplacements;
+
+// Structure joueur
+typedef struct {
+    int posX; // ligne
+    int posY; // colonne
+} t_joueur;
+
+// État d'une partie
+typedef struct {
+    t_plateau plateau;
+    t_joueur joueur;
+    t_deplacements deplacements;
+} t_moteur;
+
+void charger_niveau(t_moteur *moteur, char fichier[]);
+void demarrer_niveau(t_moteur *moteur);
+void position_joueur(t_moteur *moteur);
+t_resultatDeplacement deplacer(t_moteur *moteur, int depX, int depY);
+int traverser_couloir(t_moteur *moteur);
+bool retour_arriere(t_moteur *moteur);
+int jouer_deplacements(t_moteur *moteur, const char codes[], int nbCodes);
+bool gagne(t_moteur *moteur);
+
+#endif
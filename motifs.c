@@ -0,0 +1,542 @@
+/**
+* @file motifs.c
+* @brief Base de motifs d'interblocage précalculés
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Pour le générateur, la fenêtre est entourée d'un anneau de cases libres
+* qui représente le reste du plateau : le joueur y circule et une caisse
+* poussée dessus a quitté la fenêtre (elle ne gêne plus personne).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "motifs.h"
+
+#define MOTIF_SIGNATURE     "SKDL"
+#define NB_FENETRE          (MOTIF_LIGNES * MOTIF_COLONNES)
+#define ANCRE   (MOTIF_ANCRE_LIGNE * MOTIF_COLONNES + MOTIF_ANCRE_COLONNE)
+#define LIGNES_ANNEAU       (MOTIF_LIGNES + 2)
+#define COLONNES_ANNEAU     (MOTIF_COLONNES + 2)
+#define NB_ANNEAU           (LIGNES_ANNEAU * COLONNES_ANNEAU)
+#define ETATS_MAX           4096 // au-delà, la caisse est supposée mobile
+#define TAILLE_VUS          (ETATS_MAX * 4)
+
+/* Directions : haut, bas, gauche, droite (direction opposée : dir ^ 1) */
+
+const int MOTIF_DIR_LIGNE[4]    = {-1, 1, 0, 0};
+const int MOTIF_DIR_COLONNE[4]  = {0, 0, -1, 1};
+
+// Fenêtre en cours d'analyse, entourée de l'anneau
+typedef struct {
+    bool mur[NB_ANNEAU];
+    int fenetre[NB_ANNEAU]; // case de la fenêtre, -1 sur l'anneau
+    int voisin[NB_ANNEAU][4]; // -1 hors de l'anneau
+    uint32_t vus[TAILLE_VUS]; // états rencontrés (clé + 1, 0 : libre)
+    int places[TAILLE_VUS]; // places occupées dans vus, pour les vider
+    int nbPlaces;
+} t_analyse;
+
+/* Fonctions internes */
+
+long nombre_motifs();
+void preparer_analyse(t_analyse *analyse);
+int case_anneau(int caseFenetre);
+uint64_t zone_motif(t_analyse *analyse, int caisses, int depart);
+bool marquer_etat(t_analyse *analyse, int caisses, int joueur);
+int pousser_dans_motif(t_analyse *analyse, int caisses, uint64_t atteint,
+    int caisse, int direction);
+bool ancre_mobile(t_analyse *analyse, int caisses);
+bool motif_ancre_bloquee(t_analyse *analyse, long numero);
+bool motif_plus_libre_bloque(unsigned char bits[], long numero);
+void preparer_symetries(t_motifs *motifs);
+
+/**
+*
+* @brief Calculer le nombre de motifs (3 puissance le nombre de cases de la
+*   fenêtre hors ancre)
+* @return entier long : nombre de motifs
+*/
+long nombre_motifs()
+{
+    long nombre = 1;
+
+    for(int i = 0 ; i < MOTIF_NB_CASES ; i++){
+        nombre *= 3;
+    }
+
+    return nombre;
+}
+
+/**
+*
+* @brief Trouver la case de l'anneau qui correspond à une case de la fenêtre
+* @param caseFenetre de type entier, Entrée : case de la fenêtre
+* @return entier : case dans la grille entourée de l'anneau
+*/
+int case_anneau(int caseFenetre)
+{
+    return (caseFenetre / MOTIF_COLONNES + 1) * COLONNES_ANNEAU +
+        caseFenetre % MOTIF_COLONNES + 1;
+}
+
+/**
+*
+* @brief Calculer les voisins et la correspondance avec la fenêtre
+* @param analyse de type t_analyse, Sortie : analyse à préparer
+*/
+void preparer_analyse(t_analyse *analyse)
+{
+    int ligne, colonne;
+
+    memset(analyse->fenetre, -1, sizeof(analyse->fenetre));
+    for(int caseFenetre = 0 ; caseFenetre < NB_FENETRE ; caseFenetre++){
+        analyse->fenetre[case_anneau(caseFenetre)] = caseFenetre;
+    }
+
+    for(int numCase = 0 ; numCase < NB_ANNEAU ; numCase++){
+        for(int dir = 0 ; dir < 4 ; dir++){
+            ligne = numCase / COLONNES_ANNEAU + MOTIF_DIR_LIGNE[dir];
+            colonne = numCase % COLONNES_ANNEAU + MOTIF_DIR_COLONNE[dir];
+            analyse->voisin[numCase][dir] = (ligne >= 0 &&
+                ligne < LIGNES_ANNEAU && colonne >= 0 &&
+                colonne < COLONNES_ANNEAU) ?
+                ligne * COLONNES_ANNEAU + colonne : -1;
+        }
+    }
+}
+
+/**
+*
+* @brief Calculer les cases atteignables par le joueur
+* @param analyse de type t_analyse, Entrée : fenêtre analysée
+* @param caisses de type entier, Entrée : caisses (un bit par case de la
+*   fenêtre)
+* @param depart de type entier, Entrée : case du joueur
+* @return entier 64 bits : cases atteignables (un bit par case)
+*/
+uint64_t zone_motif(t_analyse *analyse, int caisses, int depart)
+{
+    int pile[NB_ANNEAU];
+    int nbPile = 0;
+    uint64_t atteint = (uint64_t)1 << depart;
+    int numCase, suivante;
+
+    pile[nbPile++] = depart;
+    while(nbPile > 0){
+        numCase = pile[--nbPile];
+        for(int dir = 0 ; dir < 4 ; dir++){
+            suivante = analyse->voisin[numCase][dir];
+            if(suivante >= 0 && !analyse->mur[suivante] &&
+                !((atteint >> suivante) & 1) &&
+                (analyse->fenetre[suivante] < 0 ||
+                !((caisses >> analyse->fenetre[suivante]) & 1))){
+                atteint |= (uint64_t)1 << suivante;
+                pile[nbPile++] = suivante;
+            }
+        }
+    }
+
+    return atteint;
+}
+
+/**
+*
+* @brief Noter un état (caisses + zone du joueur) comme rencontré
+* @param analyse de type t_analyse, Entrée/Sortie : fenêtre analysée
+* @param caisses de type entier, Entrée : caisses
+* @param joueur de type entier, Entrée : case la plus petite de la zone
+* @return vrai si l'état est nouveau
+*/
+bool marquer_etat(t_analyse *analyse, int caisses, int joueur)
+{
+    uint32_t cle = ((uint32_t)caisses * NB_ANNEAU + joueur) + 1;
+    uint32_t position = (cle * 2654435761u) % TAILLE_VUS;
+    bool nouveau;
+
+    while(analyse->vus[position] != 0 && analyse->vus[position] != cle){
+        position = (position + 1) % TAILLE_VUS;
+    }
+
+    nouveau = analyse->vus[position] == 0;
+    if(nouveau){
+        analyse->vus[position] = cle;
+        analyse->places[analyse->nbPlaces++] = position;
+    }
+
+    return nouveau;
+}
+
+/**
+*
+* @brief Pousser une caisse de la fenêtre si le joueur peut le faire
+* @param analyse de type t_analyse, Entrée : fenêtre analysée
+* @param caisses de type entier, Entrée : caisses avant la poussée
+* @param atteint de type entier 64 bits, Entrée : cases du joueur
+* @param caisse de type entier, Entrée : case de la fenêtre à pousser
+* @param direction de type entier, Entrée : direction de la poussée
+* @return entier : caisses après la poussée, -1 si elle est impossible
+*/
+int pousser_dans_motif(t_analyse *analyse, int caisses, uint64_t atteint,
+    int caisse, int direction)
+{
+    int depart = case_anneau(caisse);
+    int joueur = analyse->voisin[depart][direction ^ 1];
+    int arrivee = analyse->voisin[depart][direction];
+    int nouvelles = -1;
+
+    if(((caisses >> caisse) & 1) && ((atteint >> joueur) & 1) &&
+        !analyse->mur[arrivee] && (analyse->fenetre[arrivee] < 0 ||
+        !((caisses >> analyse->fenetre[arrivee]) & 1))){
+        // Une caisse poussée sur l'anneau sort de la fenêtre
+        nouvelles = caisses & ~(1 << caisse);
+        if(analyse->fenetre[arrivee] >= 0){
+            nouvelles |= 1 << analyse->fenetre[arrivee];
+        }
+    }
+
+    return nouvelles;
+}
+
+/**
+*
+* @brief Chercher une suite de poussées qui fait bouger la caisse ancre,
+*   le joueur partant de n'importe quelle zone
+* @param analyse de type t_analyse, Entrée/Sortie : fenêtre analysée
+* @param caisses de type entier, Entrée : caisses de départ
+* @return vrai si la caisse ancre peut bouger
+*/
+bool ancre_mobile(t_analyse *analyse, int caisses)
+{
+    static int fileCaisses[ETATS_MAX];
+    static int fileJoueur[ETATS_MAX];
+    uint64_t couvert = 0;
+    uint64_t atteint;
+    int debut = 0, fin = 0;
+    int numCase, joueur, nouvelles;
+    bool mobile = false;
+
+    // Une zone de départ par région libre
+    for(numCase = 0 ; numCase < NB_ANNEAU ; numCase++){
+        if(!analyse->mur[numCase] && !((couvert >> numCase) & 1) &&
+            (analyse->fenetre[numCase] < 0 ||
+            !((caisses >> analyse->fenetre[numCase]) & 1))){
+            couvert |= zone_motif(analyse, caisses, numCase);
+            marquer_etat(analyse, caisses, numCase);
+            fileCaisses[fin] = caisses;
+            fileJoueur[fin++] = numCase;
+        }
+    }
+
+    while(!mobile && debut < fin){
+        caisses = fileCaisses[debut];
+        atteint = zone_motif(analyse, caisses, fileJoueur[debut++]);
+
+        // Chaque poussée possible : case de la caisse * 4 + direction
+        for(int poussee = 0 ; !mobile && poussee < NB_FENETRE * 4 ;
+            poussee++){
+            nouvelles = pousser_dans_motif(analyse, caisses, atteint,
+                poussee / 4, poussee % 4);
+            if(nouvelles >= 0){
+                mobile = poussee / 4 == ANCRE;
+                joueur = __builtin_ctzll(zone_motif(analyse, nouvelles,
+                    case_anneau(poussee / 4)));
+
+                if(!mobile && fin < ETATS_MAX &&
+                    marquer_etat(analyse, nouvelles, joueur)){
+                    fileCaisses[fin] = nouvelles;
+                    fileJoueur[fin++] = joueur;
+                }
+                mobile = mobile || fin == ETATS_MAX;
+            }
+        }
+    }
+
+    while(analyse->nbPlaces > 0){
+        analyse->vus[analyse->places[--analyse->nbPlaces]] = 0;
+    }
+
+    return mobile;
+}
+
+/**
+*
+* @brief Décoder un motif et savoir si sa caisse ancre est bloquée
+* @param analyse de type t_analyse, Entrée/Sortie : fenêtre analysée
+* @param numero de type entier long, Entrée : numéro du motif
+* @return vrai si la caisse ancre ne peut jamais bouger
+*/
+bool motif_ancre_bloquee(t_analyse *analyse, long numero)
+{
+    int caisses = 1 << ANCRE;
+    int chiffre;
+
+    memset(analyse->mur, false, sizeof(analyse->mur));
+    for(int caseFenetre = 0 ; caseFenetre < NB_FENETRE ; caseFenetre++){
+        if(caseFenetre != ANCRE){
+            chiffre = numero % 3;
+            numero /= 3;
+            if(chiffre == MOTIF_CAISSE){
+                caisses |= 1 << caseFenetre;
+            }
+            analyse->mur[case_anneau(caseFenetre)] = chiffre == MOTIF_MUR;
+        }
+    }
+
+    return !ancre_mobile(analyse, caisses);
+}
+
+/**
+*
+* @brief Savoir si un motif avec un obstacle (caisse ou mur) en moins est
+*   déjà bloquant : un obstacle de plus ne peut pas débloquer la caisse
+* @param bits de type tableau d'octets, Entrée : motifs déjà calculés (tous
+*   ceux de numéro inférieur)
+* @param numero de type entier long, Entrée : numéro du motif
+* @return vrai si le motif est bloquant d'après un motif plus libre
+*/
+bool motif_plus_libre_bloque(unsigned char bits[], long numero)
+{
+    bool bloque = false;
+    long puissance = 1;
+    long plusLibre;
+
+    for(long reste = numero ; !bloque && reste > 0 ; reste /= 3){
+        if(reste % 3 != MOTIF_VIDE){
+            plusLibre = numero - (reste % 3) * puissance;
+            bloque = (bits[plusLibre / 8] >> (plusLibre % 8)) & 1;
+        }
+        puissance *= 3;
+    }
+
+    return bloque;
+}
+
+/**
+*
+* @brief Générer la base de motifs et l'écrire dans un fichier
+* @param fichier de type chaîne de caractères, Entrée : fichier à écrire
+* @return vrai si le fichier a été écrit
+*/
+bool generer_motifs(char fichier[])
+{
+    static t_analyse analyse;
+    long nbMotifs = nombre_motifs();
+    long nbBloques = 0;
+    long taille = (nbMotifs + 7) / 8;
+    unsigned char *bits = calloc(taille, sizeof(unsigned char));
+    unsigned char entete[MOTIF_TAILLE_ENTETE] = {0};
+    FILE *f = fopen(fichier, "wb");
+    bool reussi = f != NULL && bits != NULL;
+
+    preparer_analyse(&analyse);
+
+    for(long numero = 0 ; reussi && numero < nbMotifs ; numero++){
+        // Les motifs plus libres ont un numéro plus petit : déjà calculés
+        if(motif_plus_libre_bloque(bits, numero) ||
+            motif_ancre_bloquee(&analyse, numero)){
+            bits[numero / 8] |= 1 << (numero % 8);
+            nbBloques++;
+        }
+    }
+
+    if(reussi){
+        memcpy(entete, MOTIF_SIGNATURE, 4);
+        entete[4] = MOTIF_VERSION;
+        entete[5] = MOTIF_LIGNES;
+        entete[6] = MOTIF_COLONNES;
+        entete[7] = MOTIF_ANCRE_LIGNE;
+        entete[8] = MOTIF_ANCRE_COLONNE;
+        reussi = fwrite(entete, 1, MOTIF_TAILLE_ENTETE, f) ==
+            MOTIF_TAILLE_ENTETE && fwrite(bits, 1, taille, f) == taille;
+        printf("%ld motifs, %ld bloquants\n", nbMotifs, nbBloques);
+    }
+
+    if(f != NULL){
+        fclose(f);
+    }
+    free(bits);
+
+    return reussi;
+}
+
+/**
+*
+* @brief Calculer, pour chaque symétrie de la fenêtre, la case du voisinage
+*   qui donne chaque chiffre du numéro d'un motif
+* @param motifs de type t_motifs, Entrée/Sortie : base de motifs
+*/
+void preparer_symetries(t_motifs *motifs)
+{
+    int decalageLigne, decalageColonne;
+    int chiffre;
+
+    for(int symetrie = 0 ; symetrie < MOTIF_SYMETRIES ; symetrie++){
+        chiffre = 0;
+        for(int caseFenetre = 0 ; caseFenetre < NB_FENETRE ; caseFenetre++){
+            decalageLigne = caseFenetre / MOTIF_COLONNES - MOTIF_ANCRE_LIGNE;
+            decalageColonne = caseFenetre % MOTIF_COLONNES -
+                MOTIF_ANCRE_COLONNE;
+            if(symetrie & 1){
+                decalageLigne = -decalageLigne;
+            }
+            if(symetrie & 2){
+                decalageColonne = -decalageColonne;
+            }
+            if(caseFenetre != ANCRE){
+                motifs->chiffres[symetrie][chiffre++] =
+                    (CENTRE_VOISINAGE + decalageLigne) * TAILLE_VOISINAGE +
+                    CENTRE_VOISINAGE + decalageColonne;
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Projeter la base de motifs en mémoire
+* @param fichier de type chaîne de caractères, Entrée : fichier de la base
+* @param motifs de type t_motifs, Sortie : base chargée (vide en cas
+*   d'erreur)
+* @return vrai si la base est chargée
+*/
+bool ouvrir_motifs(char fichier[], t_motifs *motifs)
+{
+    struct stat infos;
+    const unsigned char *entete;
+    int descripteur = open(fichier, O_RDONLY);
+    bool reussi = descripteur >= 0 && fstat(descripteur, &infos) == 0 &&
+        infos.st_size == MOTIF_TAILLE_ENTETE + (nombre_motifs() + 7) / 8;
+
+    motifs->bits = NULL;
+    motifs->projection = NULL;
+    motifs->taille = 0;
+
+    if(reussi){
+        motifs->taille = infos.st_size;
+        motifs->projection = mmap(NULL, motifs->taille, PROT_READ,
+            MAP_SHARED, descripteur, 0);
+        reussi = motifs->projection != MAP_FAILED;
+    }
+
+    if(reussi){
+        entete = motifs->projection;
+        reussi = memcmp(entete, MOTIF_SIGNATURE, 4) == 0 &&
+            entete[4] == MOTIF_VERSION && entete[5] == MOTIF_LIGNES &&
+            entete[6] == MOTIF_COLONNES && entete[7] == MOTIF_ANCRE_LIGNE &&
+            entete[8] == MOTIF_ANCRE_COLONNE;
+        if(reussi){
+            motifs->bits = entete + MOTIF_TAILLE_ENTETE;
+            preparer_symetries(motifs);
+        }
+        else{
+            munmap(motifs->projection, motifs->taille);
+        }
+    }
+    if(!reussi){
+        motifs->projection = NULL;
+        motifs->taille = 0;
+    }
+
+    if(descripteur >= 0){
+        close(descripteur);
+    }
+
+    return reussi;
+}
+
+/**
+*
+* @brief Libérer la projection de la base de motifs
+* @param motifs de type t_motifs, Entrée/Sortie : base à fermer
+*/
+void fermer_motifs(t_motifs *motifs)
+{
+    if(motifs->projection != NULL){
+        munmap(motifs->projection, motifs->taille);
+    }
+    motifs->bits = NULL;
+    motifs->projection = NULL;
+    motifs->taille = 0;
+}
+
+/**
+*
+* @brief Savoir si la caisse au centre d'un voisinage est bloquée pour
+*   toujours (dans l'une des 4 symétries de la fenêtre)
+* @param motifs de type t_motifs, Entrée : base de motifs
+* @param voisinage de type t_voisinage, Entrée : contenu des cases autour
+*   de la caisse (MOTIF_VIDE, MOTIF_CAISSE ou MOTIF_MUR)
+* @return vrai si la caisse ne pourra plus jamais bouger
+*/
+bool motif_bloque(t_motifs *motifs, t_voisinage voisinage)
+{
+    const unsigned char *cases = &voisinage[0][0];
+    bool bloque = false;
+    long numero;
+
+    for(int symetrie = 0 ; motifs->bits != NULL && !bloque &&
+        symetrie < MOTIF_SYMETRIES ; symetrie++){
+        numero = 0;
+        for(int chiffre = MOTIF_NB_CASES - 1 ; chiffre >= 0 ; chiffre--){
+            numero = numero * 3 + cases[motifs->chiffres[symetrie][chiffre]];
+        }
+        bloque = (motifs->bits[numero / 8] >> (numero % 8)) & 1;
+    }
+
+    return bloque;
+}
+
+/**
+*
+* @brief Savoir si une caisse du plateau de jeu est bloquée hors d'une cible
+* @param motifs de type t_motifs, Entrée : base de motifs
+* @param plateau de type t_plateau, Entrée : plateau de jeu
+* @param ligne de type entier, Entrée : ligne de la caisse
+* @param colonne de type entier, Entrée : colonne de la caisse
+* @return vrai si la caisse n'atteindra plus jamais de cible
+*/
+bool caisse_bloquee(t_motifs *motifs, char plateau[][TAILLE], int ligne,
+    int colonne)
+{
+    t_voisinage voisinage;
+    int ligneCase, colonneCase;
+    char contenu;
+    bool bloquee = false;
+
+    for(int i = 0 ; plateau[ligne][colonne] == CAISSE &&
+        i < TAILLE_VOISINAGE ; i++){
+        for(int j = 0 ; j < TAILLE_VOISINAGE ; j++){
+            ligneCase = ligne + i - CENTRE_VOISINAGE;
+            colonneCase = colonne + j - CENTRE_VOISINAGE;
+            contenu = (ligneCase >= 0 && ligneCase < TAILLE &&
+                colonneCase >= 0 && colonneCase < TAILLE) ?
+                plateau[ligneCase][colonneCase] : MUR;
+
+            if(contenu == MUR){
+                voisinage[i][j] = MOTIF_MUR;
+            }
+            else if(contenu == CAISSE || contenu == CAISSE_SUR_CIBLE){
+                voisinage[i][j] = MOTIF_CAISSE;
+            }
+            else{
+                voisinage[i][j] = MOTIF_VIDE;
+            }
+        }
+    }
+
+    if(plateau[ligne][colonne] == CAISSE){
+        bloquee = motif_bloque(motifs, voisinage);
+    }
+
+    return bloquee;
+}
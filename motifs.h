@@ -0,0 +1,73 @@
+/**
+* @file motifs.h
+* @brief Base de motifs d'interblocage précalculés
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Un motif est une fenêtre de MOTIF_LIGNES x MOTIF_COLONNES cases (vide,
+* caisse ou mur) dont la case ancre contient une caisse. Le générateur
+* essaie toutes les fenêtres en supposant le reste du plateau vide et le
+* joueur libre d'aller partout dehors : si même ainsi la caisse ancre ne
+* peut jamais bouger, le motif est marqué bloquant. Une caisse qui vient
+* d'être poussée hors d'une cible dans un motif bloquant ne l'atteindra
+* donc plus jamais.
+*
+* Le fichier (un bit par motif) est projeté en mémoire au démarrage. La
+* recherche essaie les 4 symétries de la fenêtre, ce qui place l'ancre sur
+* chacune des 4 cases centrales.
+*
+* Format : "SKDL", version, lignes, colonnes, ligne et colonne de l'ancre,
+* 7 octets nuls, puis les bits (octet de poids faible en premier). Le
+* numéro d'un motif s'écrit en base 3 (une case par chiffre, dans l'ordre
+* de lecture, sans l'ancre).
+*/
+
+#ifndef MOTIFS_H
+#define MOTIFS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sokoban.h"
+
+#define MOTIF_LIGNES        4
+#define MOTIF_COLONNES      4
+#define MOTIF_NB_CASES      (MOTIF_LIGNES * MOTIF_COLONNES - 1) // hors ancre
+#define MOTIF_SYMETRIES     4
+#define MOTIF_ANCRE_LIGNE   1
+#define MOTIF_ANCRE_COLONNE 1
+#define MOTIF_VERSION       1
+#define MOTIF_TAILLE_ENTETE 16
+#define FICHIER_MOTIFS      "bin/motifs.db"
+
+// Voisinage d'une caisse : la caisse est au centre, chaque symétrie de la
+// fenêtre tient dedans
+#define TAILLE_VOISINAGE    5
+#define CENTRE_VOISINAGE    2
+
+// Contenu d'une case d'un motif (chiffre en base 3)
+#define MOTIF_VIDE          0
+#define MOTIF_CAISSE        1
+#define MOTIF_MUR           2
+
+// Base de motifs projetée en mémoire (bits == NULL si elle n'est pas
+// chargée : aucun motif n'est alors bloquant)
+typedef struct {
+    const unsigned char *bits;
+    void *projection;
+    size_t taille;
+    // case du voisinage lue pour chaque chiffre du numéro, par symétrie
+    int chiffres[MOTIF_SYMETRIES][MOTIF_NB_CASES];
+} t_motifs;
+
+typedef unsigned char t_voisinage[TAILLE_VOISINAGE][TAILLE_VOISINAGE];
+
+bool generer_motifs(char fichier[]);
+bool ouvrir_motifs(char fichier[], t_motifs *motifs);
+void fermer_motifs(t_motifs *motifs);
+bool motif_bloque(t_motifs *motifs, t_voisinage voisinage);
+bool caisse_bloquee(t_motifs *motifs, char plateau[][TAILLE], int ligne,
+    int colonne);
+
+#endif
@@ -0,0 +1,340 @@
+/**
+* @file optimiseur.c
+* @brief Raccourcissement d'une suite de déplacements enregistrée
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Chaque tour cherche, en parallèle, le meilleur raccourci partant de
+* chaque état de la suite, puis garde la combinaison de raccourcis
+* disjoints qui supprime le plus de poussées. Les tours s'enchaînent tant
+* qu'ils raccourcissent la suite.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "optimiseur.h"
+
+// Chemin plus court remplaçant les poussées [debut, fin[ de la suite
+typedef struct {
+    int fin;
+    int gain; // poussées économisées (0 : aucun raccourci)
+    int nbPoussees;
+    t_poussee poussees[PROFONDEUR_FENETRE];
+} t_raccourci;
+
+// Part du travail d'un thread : les fenêtres premier, premier + pas, ...
+typedef struct {
+    t_niveau *niveau;
+    t_etat *etats;
+    int nbPoussees;
+    int premier;
+    int pas;
+    t_raccourci *raccourcis;
+} t_travail;
+
+/* Fonctions internes */
+
+int retirer_boucles(t_etat etats[], t_poussee poussees[], int nbPoussees);
+void developper_fenetre(t_niveau *niveau, t_recherche *recherche,
+    long indice);
+void chercher_raccourci(t_niveau *niveau, t_etat etats[], int nbPoussees,
+    int debut, t_recherche *recherche, t_raccourci *raccourci);
+void *traiter_fenetres(void *argument);
+int choisir_raccourcis(t_raccourci raccourcis[], t_poussee poussees[],
+    int nbPoussees, int *nbRaccourcis);
+
+/**
+*
+* @brief Supprimer les poussées qui ramènent à un état déjà vu (les états
+*   sont à recalculer ensuite)
+* @param etats de type tableau de t_etat, Entrée : états de la suite
+* @param poussees de type tableau de t_poussee, Entrée/Sortie : poussées
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @return entier : nombre de poussées gardées
+*/
+int retirer_boucles(t_etat etats[], t_poussee poussees[], int nbPoussees)
+{
+    int nbGardees = 0;
+    int derniere;
+
+    for(int i = 0 ; i < nbPoussees ; i++){
+        // Reprendre depuis la dernière fois où cet état est atteint
+        derniere = nbPoussees;
+        while(derniere > i && !etats_egaux(&etats[derniere], &etats[i])){
+            derniere--;
+        }
+
+        if(derniere == nbPoussees){
+            i = nbPoussees;
+        }
+        else{
+            i = derniere;
+            poussees[nbGardees++] = poussees[i];
+        }
+    }
+
+    return nbGardees;
+}
+
+/**
+*
+* @brief Créer les noeuds atteignables en une poussée depuis un noeud
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param indice de type entier long, Entrée : noeud à développer
+*/
+void developper_fenetre(t_niveau *niveau, t_recherche *recherche,
+    long indice)
+{
+    bool atteint[NB_CASES];
+    bool zoneEnfant[NB_CASES];
+    t_etat etat = recherche->noeuds[indice].etat;
+    t_etat enfant;
+    int caisse;
+    long premier = recherche->nbNoeuds;
+
+    zone_joueur(niveau, &etat.caisses, etat.joueur, atteint);
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        for(int dir = 0 ; atteint[numCase] && dir < NB_DIRECTIONS ; dir++){
+            caisse = niveau->voisin[numCase][dir];
+
+            if(poussee_possible(niveau, &etat.caisses, caisse, dir)){
+                enfant.caisses = etat.caisses;
+                retirer_case(&enfant.caisses, caisse);
+                ajouter_case(&enfant.caisses, niveau->voisin[caisse][dir]);
+                enfant.joueur = zone_joueur(niveau, &enfant.caisses, caisse,
+                    zoneEnfant);
+                ajouter_etat(recherche, &enfant, indice, caisse, dir);
+            }
+        }
+    }
+
+    for(long i = premier ; i < recherche->nbNoeuds ; i++){
+        recherche->noeuds[i].poussees = recherche->noeuds[indice].poussees + 1;
+    }
+}
+
+/**
+*
+* @brief Chercher le raccourci qui économise le plus de poussées depuis
+*   un état de la suite (recherche en largeur bornée)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param etats de type tableau de t_etat, Entrée : états de la suite
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @param debut de type entier, Entrée : état de départ de la fenêtre
+* @param recherche de type t_recherche, Entrée/Sortie : recherche (vidée)
+* @param raccourci de type t_raccourci, Sortie : meilleur raccourci
+*/
+void chercher_raccourci(t_niveau *niveau, t_etat etats[], int nbPoussees,
+    int debut, t_recherche *recherche, t_raccourci *raccourci)
+{
+    t_noeud *noeud;
+    long indice;
+    long trouve = -1;
+
+    memset(recherche->table, 0, sizeof(long) * recherche->tailleTable);
+    recherche->nbNoeuds = 0;
+    raccourci->gain = 0;
+    ajouter_etat(recherche, &etats[debut], -1, 0, 0);
+
+    // Les noeuds sont créés couche par couche : leur tableau sert de file
+    for(indice = 0 ; indice < recherche->nbNoeuds &&
+        recherche->noeuds[indice].poussees < PROFONDEUR_FENETRE &&
+        recherche->nbNoeuds < NOEUDS_FENETRE ; indice++){
+        developper_fenetre(niveau, recherche, indice);
+    }
+
+    for(int fin = debut + 2 ; fin <= nbPoussees ; fin++){
+        indice = chercher_etat(recherche, &etats[fin]);
+        if(indice >= 0 && fin - debut - recherche->noeuds[indice].poussees >
+            raccourci->gain){
+            raccourci->gain = fin - debut - recherche->noeuds[indice].poussees;
+            raccourci->fin = fin;
+            trouve = indice;
+        }
+    }
+
+    if(trouve >= 0){
+        raccourci->nbPoussees = recherche->noeuds[trouve].poussees;
+        for(int i = raccourci->nbPoussees - 1 ; i >= 0 ; i--){
+            noeud = &recherche->noeuds[trouve];
+            raccourci->poussees[i].caisse = noeud->caisse;
+            raccourci->poussees[i].direction = noeud->direction;
+            trouve = noeud->parent;
+        }
+    }
+}
+
+/**
+*
+* @brief Traiter les fenêtres confiées à un thread
+* @param argument de type t_travail, Entrée : part du travail
+* @return NULL
+*/
+void *traiter_fenetres(void *argument)
+{
+    t_travail *travail = argument;
+    t_recherche recherche;
+
+    initialiser_recherche(&recherche, 0);
+
+    for(int debut = travail->premier ; debut < travail->nbPoussees ;
+        debut += travail->pas){
+        chercher_raccourci(travail->niveau, travail->etats,
+            travail->nbPoussees, debut, &recherche,
+            &travail->raccourcis[debut]);
+    }
+
+    liberer_recherche(&recherche);
+
+    return NULL;
+}
+
+/**
+*
+* @brief Appliquer la combinaison de raccourcis disjoints qui économise le
+*   plus de poussées
+* @param raccourcis de type tableau de t_raccourci, Entrée : meilleur
+*   raccourci depuis chaque état
+* @param poussees de type tableau de t_poussee, Entrée/Sortie : poussées
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @param nbRaccourcis de type entier, Entrée/Sortie : raccourcis appliqués
+* @return entier : nouveau nombre de poussées
+*/
+int choisir_raccourcis(t_raccourci raccourcis[], t_poussee poussees[],
+    int nbPoussees, int *nbRaccourcis)
+{
+    int *meilleur = calloc(nbPoussees + 1, sizeof(int));
+    t_poussee *anciennes = malloc(sizeof(t_poussee) * (nbPoussees + 1));
+    int nbGardees = 0;
+    int avec;
+
+    // meilleur[i] : poussées économisées au mieux à partir de l'état i
+    for(int i = nbPoussees - 1 ; i >= 0 ; i--){
+        meilleur[i] = meilleur[i + 1];
+        avec = raccourcis[i].gain > 0 ?
+            raccourcis[i].gain + meilleur[raccourcis[i].fin] : 0;
+        if(avec > meilleur[i]){
+            meilleur[i] = avec;
+        }
+        else{
+            raccourcis[i].gain = 0;
+        }
+    }
+
+    memcpy(anciennes, poussees, sizeof(t_poussee) * nbPoussees);
+    for(int i = 0 ; i < nbPoussees ; i++){
+        if(raccourcis[i].gain > 0){
+            memcpy(&poussees[nbGardees], raccourcis[i].poussees,
+                sizeof(t_poussee) * raccourcis[i].nbPoussees);
+            nbGardees += raccourcis[i].nbPoussees;
+            (*nbRaccourcis)++;
+            i = raccourcis[i].fin - 1;
+        }
+        else{
+            poussees[nbGardees++] = anciennes[i];
+        }
+    }
+
+    free(meilleur);
+    free(anciennes);
+
+    return nbGardees;
+}
+
+/**
+*
+* @brief Compter les threads à lancer (un par coeur disponible)
+* @return entier : nombre de threads, entre 1 et THREADS_MAX
+*/
+int nombre_threads(void)
+{
+    long nbCoeurs = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return nbCoeurs < 1 ? 1 : nbCoeurs > THREADS_MAX ? THREADS_MAX :
+        (int)nbCoeurs;
+}
+
+/**
+*
+* @brief Raccourcir une suite de déplacements enregistrée
+* @param plateau de type t_plateau, Entrée : niveau de départ
+* @param deplacements de type chaîne de caractères, Entrée : déplacements
+* @param nbDeplacements de type entier, Entrée : nombre de déplacements
+*   (TAILLE_SOLUTION_MAX au plus)
+* @param solution de type chaîne de caractères, Sortie : déplacements
+*   raccourcis (TAILLE_SOLUTION_MAX caractères au plus)
+* @param stats de type t_statsOptimisation, Sortie : statistiques
+* @return vrai si le niveau a pu être analysé et la suite réécrite
+*/
+bool optimiser_deplacements(t_plateau plateau, char deplacements[],
+    int nbDeplacements, char solution[], t_statsOptimisation *stats)
+{
+    t_niveau niveau;
+    t_poussee *poussees = malloc(sizeof(t_poussee) * (nbDeplacements + 1));
+    t_etat *etats = malloc(sizeof(t_etat) * (nbDeplacements + 1));
+    t_raccourci *raccourcis;
+    pthread_t threads[THREADS_MAX];
+    t_travail travaux[THREADS_MAX];
+    int nbPoussees = 0, avant = -1;
+    int longueur = -1;
+
+    memset(stats, 0, sizeof(t_statsOptimisation));
+    stats->nbThreads = nombre_threads();
+    stats->deplacements[0] = nbDeplacements;
+    analyser_niveau(plateau, &niveau);
+
+    if(niveau.joueurDepart >= 0){
+        nbPoussees = rejouer_deplacements(&niveau, deplacements,
+            nbDeplacements, poussees);
+        stats->poussees[0] = nbPoussees;
+    }
+    raccourcis = malloc(sizeof(t_raccourci) * (nbPoussees + 1));
+
+    while(niveau.joueurDepart >= 0 && nbPoussees != avant){
+        avant = nbPoussees;
+        stats->tours++;
+        calculer_etats(&niveau, poussees, nbPoussees, etats);
+        nbPoussees = retirer_boucles(etats, poussees, nbPoussees);
+        stats->boucles += avant - nbPoussees;
+        calculer_etats(&niveau, poussees, nbPoussees, etats);
+
+        for(int i = 0 ; i < stats->nbThreads ; i++){
+            travaux[i] = (t_travail){&niveau, etats, nbPoussees, i,
+                stats->nbThreads, raccourcis};
+            pthread_create(&threads[i], NULL, traiter_fenetres, &travaux[i]);
+        }
+        for(int i = 0 ; i < stats->nbThreads ; i++){
+            pthread_join(threads[i], NULL);
+        }
+
+        nbPoussees = choisir_raccourcis(raccourcis, poussees, nbPoussees,
+            &stats->raccourcis);
+    }
+
+    if(niveau.joueurDepart >= 0){
+        longueur = ecrire_poussees(&niveau, poussees, nbPoussees, solution);
+    }
+    if(longueur > nbDeplacements){
+        // Moins de poussées mais plus de marche : garder l'original
+        memcpy(solution, deplacements, nbDeplacements);
+        solution[nbDeplacements] = '\0';
+        longueur = nbDeplacements;
+        nbPoussees = stats->poussees[0];
+    }
+    stats->poussees[1] = nbPoussees;
+    stats->deplacements[1] = longueur;
+
+    free(poussees);
+    free(etats);
+    free(raccourcis);
+
+    return longueur >= 0;
+}
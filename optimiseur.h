@@ -0,0 +1,44 @@
+/**
+* @file optimiseur.h
+* @brief Raccourcissement d'une suite de déplacements enregistrée
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Les déplacements sont rejoués pour en extraire les poussées, puis :
+* - les boucles (retour à un état déjà vu) sont supprimées ;
+* - depuis chaque état, une courte recherche en largeur cherche un chemin
+*   plus court vers un état situé plus loin dans la suite (fenêtres
+*   traitées en parallèle sur tous les coeurs) ;
+* - les déplacements du joueur entre deux poussées sont recalculés au plus
+*   court.
+* L'état final (caisses et zone du joueur) est toujours conservé.
+*/
+
+#ifndef OPTIMISEUR_H
+#define OPTIMISEUR_H
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+
+#define PROFONDEUR_FENETRE  10      // poussées max d'un raccourci
+#define NOEUDS_FENETRE      20000   // noeuds max d'une recherche de fenêtre
+#define THREADS_MAX         64
+
+// Statistiques d'une optimisation
+typedef struct {
+    int poussees[2]; // avant, après
+    int deplacements[2]; // avant, après
+    int boucles; // poussées supprimées par les boucles
+    int raccourcis; // fenêtres remplacées par un chemin plus court
+    int tours;
+    int nbThreads;
+} t_statsOptimisation;
+
+bool optimiser_deplacements(t_plateau plateau, char deplacements[],
+    int nbDeplacements, char solution[], t_statsOptimisation *stats);
+int nombre_threads(void);
+
+#endif
@@ -0,0 +1,55 @@
+/**
+* @file outil_anim.c
+* @brief Outil de conversion et de lecture des animations .anim
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Utilisation :
+* - outil_anim convertir <dossier> <fichier.anim>
+* - outil_anim jouer <fichier.anim> [boucles]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "anim_delta.h"
+
+#define DELAI_IMAGE_MS  100
+#define BOUCLES_DEFAUT  4
+
+/**
+*
+* @brief Convertir ou jouer une animation selon les arguments
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @return entier : code de sortie
+*/
+int main(int argc, char *argv[])
+{
+    bool reussi = false;
+    int nbBoucles = BOUCLES_DEFAUT;
+
+    if(argc == 4 && strcmp(argv[1], "convertir") == 0){
+        reussi = convertir_dossier_anim(argv[2], argv[3]);
+    }
+    else if((argc == 3 || argc == 4) && strcmp(argv[1], "jouer") == 0){
+        if(argc == 4){
+            nbBoucles = atoi(argv[3]);
+        }
+        reussi = jouer_anim(argv[2], nbBoucles, DELAI_IMAGE_MS);
+    }
+    else{
+        printf("Utilisation : %s convertir <dossier> <fichier.anim>\n",
+            argv[0]);
+        printf("              %s jouer <fichier.anim> [boucles]\n", argv[0]);
+    }
+
+    if(argc > 1 && !reussi){
+        printf("ERREUR SUR FICHIER\n");
+    }
+
+    return reussi ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,409 @@
+/**
+* @file outil_bench.c
+* @brief Mesures de performance du jeu (moteur, annulation, chargement,
+*   rendu)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Utilisation : bench [niveau.sok] [repetitions]
+* Chaque mesure est faite ECHAUFFEMENT fois sans être comptée, puis
+* repetitions fois ; chaque échantillon est une série d'opérations dont
+* la durée moyenne est retenue. Le résumé (minimum, médiane, moyenne,
+* écart type, maximum, en nanosecondes par opération) est écrit en JSON
+* sur la sortie standard, pour comparer deux versions du jeu.
+*
+* Les fonctions mesurées sont celles du jeu : deplacer, retour_arriere,
+* charger_partie et gagne viennent de libsokoban (voir moteur.h), le rendu
+* (écrit dans /dev/null) de affichage.c.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "motifs.h"
+#include "partie.h"
+#include "affichage.h"
+
+#define NIVEAU_BENCH        "levels/niveau4.sok"
+#define REPETITIONS         30
+#define REPETITIONS_MAX     1000
+#define ECHAUFFEMENT        3
+#define COUPS_BENCH         900   // moins que MAX_DEP
+#define APPELS_GAGNE        10000
+#define CHARGEMENTS         200
+#define RENDUS_PLATEAU      2000
+#define RENDUS_COMPLETS     2000
+#define GRAINE_BENCH        2026
+#define NB_MESURES          6
+
+// Mesures faites, dans l'ordre du fichier JSON
+typedef enum {
+    MESURE_DEPLACER,
+    MESURE_RETOUR,
+    MESURE_CHARGEMENT,
+    MESURE_GAGNE,
+    MESURE_PLATEAU,
+    MESURE_IMAGE
+} t_typeMesure;
+
+const char NOMS_MESURES[NB_MESURES][24] = {
+    "deplacer", "retour_arriere", "charger_partie", "gagne",
+    "afficher_plateau", "image_complete"
+};
+
+// Déplacements du joueur : haut, bas, gauche, droite
+const int BENCH_DEP_X[4] = {-1, 1, 0, 0};
+const int BENCH_DEP_Y[4] = {0, 0, -1, 1};
+
+// Données communes à toutes les mesures
+typedef struct {
+    t_partie *jeu;
+    t_plateau plateau; // niveau chargé
+    char *fichier;
+    int directions[COUPS_BENCH]; // suite de déplacements rejouée
+} t_banc;
+
+// Echantillons d'une mesure (nanosecondes par opération)
+typedef struct {
+    int operations; // opérations du dernier échantillon
+    int nbEchantillons;
+    double echantillons[REPETITIONS_MAX];
+} t_mesure;
+
+// Sorties standard mises de côté pendant un rendu
+typedef struct {
+    int sortie;
+    int erreurs;
+} t_sorties;
+
+double horloge_ns(void);
+void preparer_partie(t_banc *banc);
+void jouer_coups(t_banc *banc);
+t_sorties rediriger_sorties(void);
+void retablir_sorties(t_sorties sorties);
+double chronometrer(t_banc *banc, t_typeMesure type, int *operations);
+double echantillon(t_banc *banc, t_typeMesure type, int *operations);
+void repeter_mesure(t_banc *banc, t_typeMesure type, int nbRepetitions,
+    t_mesure *mesure);
+int comparer_durees(const void *dureeA, const void *dureeB);
+void ecrire_mesure(FILE *fichier, t_typeMesure type, t_mesure *mesure);
+void ecrire_json(FILE *fichier, t_banc *banc, t_mesure mesures[],
+    int nbRepetitions);
+
+/**
+*
+* @brief Lancer toutes les mesures et écrire le résumé
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @return entier : code de sortie
+*/
+int main(int argc, char *argv[])
+{
+    t_banc banc;
+    t_mesure *mesures = calloc(NB_MESURES, sizeof(t_mesure));
+    int nbRepetitions = argc >= 3 ? atoi(argv[2]) : REPETITIONS;
+
+    if(nbRepetitions < 1 || nbRepetitions > REPETITIONS_MAX){
+        nbRepetitions = REPETITIONS;
+    }
+
+    banc.fichier = argc >= 2 ? argv[1] : NIVEAU_BENCH;
+    banc.jeu = calloc(1, sizeof(t_partie));
+    charger_partie(banc.plateau, banc.fichier);
+    ouvrir_motifs(FICHIER_MOTIFS, &banc.jeu->motifs);
+
+    // Suite fixe : les mêmes coups d'une version du jeu à l'autre
+    srand(GRAINE_BENCH);
+    for(int i = 0 ; i < COUPS_BENCH ; i++){
+        banc.directions[i] = rand() % 4;
+    }
+
+    for(int type = 0 ; type < NB_MESURES ; type++){
+        repeter_mesure(&banc, type, nbRepetitions, &mesures[type]);
+    }
+    ecrire_json(stdout, &banc, mesures, nbRepetitions);
+
+    fermer_motifs(&banc.jeu->motifs);
+    free(banc.jeu);
+    free(mesures);
+
+    return EXIT_SUCCESS;
+}
+
+/**
+*
+* @brief Lire l'horloge monotone
+* @return réel : temps en nanosecondes
+*/
+double horloge_ns(void)
+{
+    struct timespec temps;
+
+    clock_gettime(CLOCK_MONOTONIC, &temps);
+
+    return temps.tv_sec * 1e9 + temps.tv_nsec;
+}
+
+/**
+*
+* @brief Remettre la partie au début du niveau (comme au chargement dans
+*   le jeu, sans thread de vérification)
+* @param banc de type t_banc, Entrée/Sortie : données des mesures
+*/
+void preparer_partie(t_banc *banc)
+{
+    t_partie *jeu = banc->jeu;
+
+    memcpy(jeu->moteur.plateau, banc->plateau, sizeof(t_plateau));
+    strncpy(jeu->nomFichier, banc->fichier, sizeof(jeu->nomFichier) - 1);
+    jeu->estFinis = false;
+    jeu->zoom = ZOOM_MIN;
+    jeu->tentatives = 1;
+    jeu->coupBloquant = -1;
+    jeu->coupConseil = -1;
+    jeu->surveillance = NULL;
+    jeu->resolubilite = VERDICT_INCONNU;
+    jeu->vue.lignesTerminal = LIGNES_TERMINAL;
+    jeu->vue.colonnesTerminal = COLONNES_TERMINAL;
+    jeu->vue.nbLignes = 0;
+    demarrer_niveau(&jeu->moteur);
+    mettre_a_jour_vue(jeu);
+}
+
+/**
+*
+* @brief Jouer la suite de déplacements depuis la position courante
+* @param banc de type t_banc, Entrée/Sortie : données des mesures
+*/
+void jouer_coups(t_banc *banc)
+{
+    for(int i = 0 ; i < COUPS_BENCH ; i++){
+        deplacer(&banc->jeu->moteur, BENCH_DEP_X[banc->directions[i]],
+            BENCH_DEP_Y[banc->directions[i]]);
+    }
+}
+
+/**
+*
+* @brief Envoyer la sortie standard et les erreurs dans /dev/null
+* @return t_sorties : sorties d'origine, à rétablir
+*/
+t_sorties rediriger_sorties(void)
+{
+    t_sorties sorties;
+    int nul = open("/dev/null", O_WRONLY);
+
+    fflush(stdout);
+    sorties.sortie = dup(STDOUT_FILENO);
+    sorties.erreurs = dup(STDERR_FILENO);
+    dup2(nul, STDOUT_FILENO);
+    dup2(nul, STDERR_FILENO);
+    close(nul);
+
+    return sorties;
+}
+
+/**
+*
+* @brief Rétablir la sortie standard et les erreurs
+* @param sorties de type t_sorties, Entrée : sorties d'origine
+*/
+void retablir_sorties(t_sorties sorties)
+{
+    fflush(stdout);
+    dup2(sorties.sortie, STDOUT_FILENO);
+    dup2(sorties.erreurs, STDERR_FILENO);
+    close(sorties.sortie);
+    close(sorties.erreurs);
+}
+
+/**
+*
+* @brief Chronométrer une série d'opérations sur la partie préparée
+* @param banc de type t_banc, Entrée/Sortie : données des mesures
+* @param type de type t_typeMesure, Entrée : opération mesurée
+* @param operations de type entier, Sortie : opérations de la série
+* @return réel : durée de la série en nanosecondes
+*/
+double chronometrer(t_banc *banc, t_typeMesure type, int *operations)
+{
+    volatile int nbGagnes = 0;
+    double debut = horloge_ns();
+
+    switch(type){
+        case MESURE_DEPLACER:
+            *operations = COUPS_BENCH;
+            jouer_coups(banc);
+            break;
+        case MESURE_RETOUR:
+            *operations = banc->jeu->moteur.deplacements.nbDeplacements;
+            while(banc->jeu->moteur.deplacements.nbDeplacements > 0){
+                retour_arriere(&banc->jeu->moteur);
+            }
+            break;
+        case MESURE_CHARGEMENT:
+            *operations = CHARGEMENTS;
+            for(int i = 0 ; i < CHARGEMENTS ; i++){
+                charger_partie(banc->jeu->moteur.plateau, banc->fichier);
+            }
+            break;
+        case MESURE_GAGNE:
+            *operations = APPELS_GAGNE;
+            for(int i = 0 ; i < APPELS_GAGNE ; i++){
+                nbGagnes += gagne(&banc->jeu->moteur);
+            }
+            break;
+        case MESURE_PLATEAU:
+            *operations = RENDUS_PLATEAU;
+            for(int i = 0 ; i < RENDUS_PLATEAU ; i++){
+                afficher_plateau(*banc->jeu);
+            }
+            fflush(stdout);
+            break;
+        case MESURE_IMAGE:
+            *operations = RENDUS_COMPLETS;
+            for(int i = 0 ; i < RENDUS_COMPLETS ; i++){
+                rafraichir_affichage(banc->jeu);
+            }
+            fflush(stdout);
+            break;
+    }
+
+    return horloge_ns() - debut;
+}
+
+/**
+*
+* @brief Mesurer une série d'opérations depuis le début du niveau
+* @param banc de type t_banc, Entrée/Sortie : données des mesures
+* @param type de type t_typeMesure, Entrée : opération mesurée
+* @param operations de type entier, Sortie : opérations de la série
+* @return réel : durée moyenne d'une opération en nanosecondes
+*/
+double echantillon(t_banc *banc, t_typeMesure type, int *operations)
+{
+    bool rendu = type == MESURE_PLATEAU || type == MESURE_IMAGE;
+    t_sorties sorties = {-1, -1};
+    double duree;
+
+    preparer_partie(banc);
+    if(type == MESURE_RETOUR){
+        jouer_coups(banc);
+    }
+    if(rendu){
+        sorties = rediriger_sorties();
+    }
+
+    duree = chronometrer(banc, type, operations);
+
+    if(rendu){
+        retablir_sorties(sorties);
+    }
+
+    return *operations > 0 ? duree / *operations : 0;
+}
+
+/**
+*
+* @brief Faire les passages d'échauffement puis les échantillons d'une
+*   mesure
+* @param banc de type t_banc, Entrée/Sortie : données des mesures
+* @param type de type t_typeMesure, Entrée : opération mesurée
+* @param nbRepetitions de type entier, Entrée : nombre d'échantillons
+* @param mesure de type t_mesure, Sortie : échantillons
+*/
+void repeter_mesure(t_banc *banc, t_typeMesure type, int nbRepetitions,
+    t_mesure *mesure)
+{
+    for(int i = 0 ; i < ECHAUFFEMENT ; i++){
+        echantillon(banc, type, &mesure->operations);
+    }
+
+    mesure->nbEchantillons = nbRepetitions;
+    for(int i = 0 ; i < nbRepetitions ; i++){
+        mesure->echantillons[i] = echantillon(banc, type,
+            &mesure->operations);
+    }
+}
+
+/**
+*
+* @brief Ordonner deux durées pour qsort
+* @param dureeA de type réel, Entrée : première durée
+* @param dureeB de type réel, Entrée : seconde durée
+* @return entier : négatif, nul ou positif
+*/
+int comparer_durees(const void *dureeA, const void *dureeB)
+{
+    double premiere = *(const double *)dureeA;
+    double seconde = *(const double *)dureeB;
+
+    return (premiere > seconde) - (premiere < seconde);
+}
+
+/**
+*
+* @brief Écrire le résumé d'une mesure (objet JSON)
+* @param fichier de type FILE*, Entrée : fichier de sortie
+* @param type de type t_typeMesure, Entrée : opération mesurée
+* @param mesure de type t_mesure, Entrée/Sortie : échantillons (triés)
+*/
+void ecrire_mesure(FILE *fichier, t_typeMesure type, t_mesure *mesure)
+{
+    int nombre = mesure->nbEchantillons;
+    double *durees = mesure->echantillons;
+    double somme = 0, ecarts = 0, moyenne, mediane;
+
+    qsort(durees, nombre, sizeof(double), comparer_durees);
+    for(int i = 0 ; i < nombre ; i++){
+        somme += durees[i];
+    }
+    moyenne = somme / nombre;
+    for(int i = 0 ; i < nombre ; i++){
+        ecarts += (durees[i] - moyenne) * (durees[i] - moyenne);
+    }
+    mediane = nombre % 2 ? durees[nombre / 2] :
+        (durees[nombre / 2 - 1] + durees[nombre / 2]) / 2;
+
+    fprintf(fichier, "    {\"nom\": \"%s\", \"operations\": %d, "
+        "\"min\": %.2f, \"mediane\": %.2f, \"moyenne\": %.2f, "
+        "\"ecart_type\": %.2f, \"max\": %.2f}", NOMS_MESURES[type],
+        mesure->operations, durees[0], mediane, moyenne,
+        nombre > 1 ? sqrt(ecarts / (nombre - 1)) : 0.0,
+        durees[nombre - 1]);
+}
+
+/**
+*
+* @brief Écrire le résumé de toutes les mesures au format JSON
+* @param fichier de type FILE*, Entrée : fichier de sortie
+* @param banc de type t_banc, Entrée : données des mesures
+* @param mesures de type tableau de t_mesure, Entrée/Sortie : échantillons
+* @param nbRepetitions de type entier, Entrée : échantillons par mesure
+*/
+void ecrire_json(FILE *fichier, t_banc *banc, t_mesure mesures[],
+    int nbRepetitions)
+{
+    fprintf(fichier, "{\n");
+    fprintf(fichier, "  \"niveau\": \"%s\",\n", banc->fichier);
+    fprintf(fichier, "  \"motifs\": %s,\n",
+        banc->jeu->motifs.bits != NULL ? "true" : "false");
+    fprintf(fichier, "  \"repetitions\": %d,\n", nbRepetitions);
+    fprintf(fichier, "  \"echauffement\": %d,\n", ECHAUFFEMENT);
+    fprintf(fichier, "  \"unite\": \"ns/op\",\n");
+    fprintf(fichier, "  \"mesures\": [\n");
+    for(int type = 0 ; type < NB_MESURES ; type++){
+        ecrire_mesure(fichier, type, &mesures[type]);
+        fprintf(fichier, type < NB_MESURES - 1 ? ",\n" : "\n");
+    }
+    fprintf(fichier, "  ]\n}\n");
+}
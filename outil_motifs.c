@@ -0,0 +1,41 @@
+/**
+* @file outil_motifs.c
+* @brief Générateur de la base de motifs d'interblocage
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Utilisation :
+* - motifs [fichier.db]
+*   Essaie toutes les fenêtres et écrit la base (FICHIER_MOTIFS par défaut).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "motifs.h"
+
+/**
+*
+* @brief Générer la base de motifs dans le fichier demandé
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @return entier : code de sortie
+*/
+int main(int argc, char *argv[])
+{
+    bool reussi = false;
+
+    if(argc <= 2){
+        reussi = generer_motifs(argc == 2 ? argv[1] : FICHIER_MOTIFS);
+        if(!reussi){
+            printf("ERREUR SUR FICHIER\n");
+        }
+    }
+    else{
+        printf("Utilisation : %s [fichier.db]\n", argv[0]);
+    }
+
+    return reussi ? EXIT_SUCCESS : EXIT_FAILURE;
+}
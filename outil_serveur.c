@@ -0,0 +1,146 @@
+/**
+* @file outil_serveur.c
+* @brief Serveur de parties (voir serveur.h)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Utilisation : serveur [--unix chemin | --tcp port] [--threads n]
+*                       [--robots]
+* Par défaut, le serveur écoute sur le socket Unix FICHIER_SOCKET avec un
+* thread par coeur. Avec --robots, il parle le protocole binaire de
+* robot.h, sur FICHIER_SOCKET_ROBOTS par défaut. Il s'arrête proprement
+* sur Ctrl+C (SIGINT) ou SIGTERM.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include "serveur.h"
+
+// Passe à 1 sur SIGINT ou SIGTERM
+volatile sig_atomic_t arretServeur = 0;
+
+void demander_arret(int signal);
+bool lire_options(int argc, char *argv[], bool *robots, char **socketUnix,
+    int *port, int *nbThreads);
+
+/**
+*
+* @brief Lancer le serveur et attendre son arrêt
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @return entier : code de sortie
+*/
+int main(int argc, char *argv[])
+{
+    t_serveur serveur;
+    char *socketUnix = NULL;
+    int port = 0;
+    long nbCoeurs = sysconf(_SC_NPROCESSORS_ONLN);
+    int nbThreads = nbCoeurs < 1 ? 1 : nbCoeurs > THREADS_SERVEUR_MAX ?
+        THREADS_SERVEUR_MAX : (int)nbCoeurs;
+    bool robots;
+    bool reussi = lire_options(argc, argv, &robots, &socketUnix, &port,
+        &nbThreads);
+
+    if(!reussi){
+        printf("Utilisation : %s [--unix chemin | --tcp port] "
+            "[--threads n] [--robots]\n", argv[0]);
+    }
+    else if(!ouvrir_serveur(&serveur, socketUnix, port, robots)){
+        perror("Ouverture du serveur");
+        reussi = false;
+    }
+    else{
+        signal(SIGINT, demander_arret);
+        signal(SIGTERM, demander_arret);
+        if(socketUnix != NULL){
+            printf("Serveur prêt sur %s (%d threads)\n", socketUnix,
+                nbThreads);
+        }
+        else{
+            printf("Serveur prêt sur 127.0.0.1:%d (%d threads)\n", port,
+                nbThreads);
+        }
+        fflush(stdout);
+
+        servir(&serveur, nbThreads, &arretServeur);
+        printf("\nArrêt : %ld connexion(s) servie(s), %ld encore ouverte(s)"
+            "\n", serveur.nbConnexions, serveur.nbSessions);
+        fermer_serveur(&serveur);
+    }
+
+    return reussi ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+*
+* @brief Demander l'arrêt du serveur (gestionnaire de signal)
+* @param signal de type entier, Entrée : signal reçu
+*/
+void demander_arret(int signal)
+{
+    (void)signal;
+    arretServeur = 1;
+}
+
+/**
+*
+* @brief Lire les options de la ligne de commande
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @param robots de type booléen, Sortie : protocole binaire des robots
+* @param socketUnix de type chaîne de caractères, Sortie : chemin du
+*   socket Unix (NULL si TCP est choisi)
+* @param port de type entier, Entrée/Sortie : port TCP
+* @param nbThreads de type entier, Entrée/Sortie : nombre de threads
+* @return vrai si les options sont valides
+*/
+bool lire_options(int argc, char *argv[], bool *robots, char **socketUnix,
+    int *port, int *nbThreads)
+{
+    bool valides = true;
+    bool tcp = false;
+    int i = 1;
+
+    *robots = false;
+    *socketUnix = NULL;
+    while(i < argc && valides){
+        // --robots est la seule option sans valeur
+        valides = i + 1 < argc || strcmp(argv[i], "--robots") == 0;
+        if(strcmp(argv[i], "--robots") == 0){
+            *robots = true;
+            i--;
+        }
+        else if(valides && strcmp(argv[i], "--unix") == 0){
+            *socketUnix = argv[i + 1];
+        }
+        else if(valides && strcmp(argv[i], "--tcp") == 0){
+            tcp = true;
+            *port = atoi(argv[i + 1]);
+            valides = *port > 0 && *port < 65536;
+        }
+        else if(valides && strcmp(argv[i], "--threads") == 0){
+            *nbThreads = atoi(argv[i + 1]);
+            valides = *nbThreads >= 1 && *nbThreads <= THREADS_SERVEUR_MAX;
+        }
+        else{
+            valides = false;
+        }
+        i += 2;
+    }
+
+    if(tcp){
+        *socketUnix = NULL;
+    }
+    else if(*socketUnix == NULL){
+        *socketUnix = *robots ? FICHIER_SOCKET_ROBOTS : FICHIER_SOCKET;
+    }
+
+    return valides;
+}
@@ -0,0 +1,535 @@
+/**
+* @file outil_solveur.c
+* @brief Outil de résolution automatique des niveaux
+* @author Liam CHARPENTIER
+* @version 5
+* @date 19/10/2026
+*
+* Utilisation :
+* - solveur <niveau.sok> [deplacements.dep]
+*   La solution est affichée et, si demandé, enregistrée au format des
+*   fichiers de déplacements du jeu. Une solution déjà trouvée (cache
+*   FICHIER_CACHE, voir cache.h) est rendue sans recherche.
+* - solveur --comparer <niveau.sok>...
+*   Compare les heuristiques, avec et sans macros ni base de motifs, et
+*   la recherche en largeur menée des deux bouts (noeuds et temps), sur
+*   chaque niveau.
+* - solveur --optimiser <niveau.sok> <entree.dep> <sortie.dep>
+*   Raccourcit des déplacements enregistrés (voir optimiseur.h) et écrit
+*   le résultat au même format.
+* - solveur --doublons <niveau.sok>...
+*   Regroupe les niveaux identiques à un décalage, une rotation ou un
+*   retournement près (voir canonique.h), calculés sur tous les coeurs.
+* - solveur --generer <nombre> <dossier> [graine]
+*   Crée des niveaux résolubles au hasard (voir generateur.h) sur tous les
+*   coeurs et les écrit dans le dossier, avec leur note.
+* - solveur --difficulte <sortie.tsv> <niveau.sok>...
+*   Estime la difficulté de chaque niveau (voir difficulte.h) sur tous les
+*   coeurs et écrit la collection triée du plus facile au plus difficile.
+* La base de motifs (FICHIER_MOTIFS, voir make motifs) est utilisée si elle
+* existe.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "optimiseur.h"
+#include "canonique.h"
+#include "cache.h"
+#include "generateur.h"
+#include "difficulte.h"
+
+#define NB_REGLAGES 6
+#define TAILLE_CHEMIN 512
+
+const t_heuristique HEURISTIQUES[NB_REGLAGES] = {
+    HEURISTIQUE_AUCUNE, HEURISTIQUE_PROCHE, HEURISTIQUE_AFFECTATION,
+    HEURISTIQUE_AFFECTATION, HEURISTIQUE_AFFECTATION, HEURISTIQUE_AUCUNE
+};
+const bool MACROS[NB_REGLAGES] = {false, false, false, true, true, false};
+const bool MOTIFS[NB_REGLAGES] = {false, false, false, false, true, false};
+const bool BIDIRECTIONNEL[NB_REGLAGES] = {
+    false, false, false, false, false, true
+};
+// Part du travail d'un thread : les fichiers premier, premier + pas, ...
+typedef struct {
+    char **fichiers;
+    int nbFichiers;
+    int premier;
+    int pas;
+    t_forme *formes;
+    uint64_t *empreintes;
+} t_lot;
+
+// Empreinte d'un fichier, triée pour rapprocher les doublons
+typedef struct {
+    uint64_t empreinte;
+    int indice;
+} t_empreinte;
+
+const char NOMS_REGLAGES[NB_REGLAGES][16] = {
+    "aucune", "proche", "affectation", "affect.+macros", "+motifs",
+    "bidirect."
+};
+
+bool resoudre_fichier(char fichier[], char fichierDeplacements[],
+    t_motifs *motifs, t_cache *cache);
+double mesurer_resolution(t_plateau plateau, t_optionsSolveur *options,
+    t_statsSolveur *stats);
+void comparer_heuristiques(int nbFichiers, char *fichiers[],
+    t_motifs *motifs);
+bool optimiser_fichier(char fichier[], char fichierEntree[],
+    char fichierSortie[]);
+void *canoniser_fichiers(void *argument);
+int ordonner_empreintes(const void *empreinteA, const void *empreinteB);
+void chercher_doublons(int nbFichiers, char *fichiers[]);
+bool generer_fichiers(int nbNiveaux, char dossier[], uint64_t graine,
+    t_motifs *motifs);
+bool classer_difficulte(char fichierSortie[], int nbFichiers,
+    char *fichiers[], t_motifs *motifs);
+
+/**
+*
+* @brief Résoudre le niveau passé en argument ou comparer les heuristiques
+* @param argc de type entier, Entrée : nombre d'arguments
+* @param argv de type tableau de chaînes, Entrée : arguments
+* @return entier : code de sortie
+*/
+int main(int argc, char *argv[])
+{
+    bool reussi = false;
+    t_motifs motifs;
+    t_cache cache;
+
+    ouvrir_motifs(FICHIER_MOTIFS, &motifs);
+    ouvrir_cache(FICHIER_CACHE, &cache);
+
+    if(argc >= 3 && strcmp(argv[1], "--comparer") == 0){
+        comparer_heuristiques(argc - 2, &argv[2], &motifs);
+        reussi = true;
+    }
+    else if(argc == 5 && strcmp(argv[1], "--optimiser") == 0){
+        reussi = optimiser_fichier(argv[2], argv[3], argv[4]);
+    }
+    else if(argc >= 3 && strcmp(argv[1], "--doublons") == 0){
+        chercher_doublons(argc - 2, &argv[2]);
+        reussi = true;
+    }
+    else if((argc == 4 || argc == 5) && strcmp(argv[1], "--generer") == 0){
+        // Sans graine, l'heure : elle est affichée pour refaire la série
+        reussi = generer_fichiers(atoi(argv[2]), argv[3], argc == 5 ?
+            strtoull(argv[4], NULL, 10) : (uint64_t)time(NULL), &motifs);
+    }
+    else if(argc >= 4 && strcmp(argv[1], "--difficulte") == 0){
+        reussi = classer_difficulte(argv[2], argc - 3, &argv[3], &motifs);
+    }
+    else if(argc == 2 || argc == 3){
+        reussi = resoudre_fichier(argv[1], argc == 3 ? argv[2] : NULL,
+            &motifs, &cache);
+    }
+    else{
+        printf("Utilisation : %s <niveau.sok> [deplacements.dep]\n",
+            argv[0]);
+        printf("              %s --comparer <niveau.sok>...\n", argv[0]);
+        printf("              %s --optimiser <niveau.sok> <entree.dep> "
+            "<sortie.dep>\n", argv[0]);
+        printf("              %s --doublons <niveau.sok>...\n", argv[0]);
+        printf("              %s --generer <nombre> <dossier> [graine]\n",
+            argv[0]);
+        printf("              %s --difficulte <sortie.tsv> <niveau.sok>..."
+            "\n", argv[0]);
+    }
+
+    fermer_motifs(&motifs);
+    fermer_cache(&cache);
+
+    return reussi ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+*
+* @brief Résoudre un niveau, afficher et enregistrer la solution
+* @param fichier de type chaîne de caractères, Entrée : fichier du niveau
+* @param fichierDeplacements de type chaîne de caractères, Entrée : fichier
+*   où enregistrer la solution (NULL pour ne pas l'enregistrer)
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide)
+* @param cache de type t_cache, Entrée/Sortie : solutions déjà trouvées
+* @return vrai si une solution a été trouvée
+*/
+bool resoudre_fichier(char fichier[], char fichierDeplacements[],
+    t_motifs *motifs, t_cache *cache)
+{
+    t_plateau plateau;
+    t_statsSolveur stats;
+    t_optionsSolveur options;
+    char solution[TAILLE_SOLUTION_MAX];
+
+    charger_partie(plateau, fichier);
+    options_par_defaut(&options);
+    options.motifs = motifs->bits != NULL ? motifs : NULL;
+    options.cache = cache;
+
+    if(resoudre_niveau_options(plateau, solution, &stats, &options)){
+        printf("Solution : %s\n", solution);
+        printf("%d déplacements, %d poussées\n", stats.nbDeplacements,
+            stats.nbPoussees);
+
+        if(fichierDeplacements != NULL){
+            enregistrer_deplacements(solution, stats.nbDeplacements,
+                fichierDeplacements);
+        }
+    }
+    else{
+        printf("Aucune solution trouvée\n");
+    }
+
+    if(stats.enCache){
+        printf("Solution connue (cache), trouvée en %ld noeuds explorés\n",
+            stats.noeudsExplores);
+    }
+    else{
+        printf("%ld noeuds explorés, %ld noeuds créés\n",
+            stats.noeudsExplores, stats.noeudsCrees);
+    }
+
+    return stats.trouve;
+}
+
+/**
+*
+* @brief Résoudre un plateau et mesurer le temps pris
+* @param plateau de type t_plateau, Entrée : plateau à résoudre
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param stats de type t_statsSolveur, Sortie : statistiques
+* @return réel : durée en millisecondes
+*/
+double mesurer_resolution(t_plateau plateau, t_optionsSolveur *options,
+    t_statsSolveur *stats)
+{
+    struct timespec debut, fin;
+    char solution[TAILLE_SOLUTION_MAX];
+
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    resoudre_niveau_options(plateau, solution, stats, options);
+    clock_gettime(CLOCK_MONOTONIC, &fin);
+
+    return (fin.tv_sec - debut.tv_sec) * 1000.0 +
+        (fin.tv_nsec - debut.tv_nsec) / 1000000.0;
+}
+
+/**
+*
+* @brief Comparer les heuristiques, les macros et la base de motifs sur
+*   plusieurs niveaux
+* @param nbFichiers de type entier, Entrée : nombre de niveaux
+* @param fichiers de type tableau de chaînes, Entrée : fichiers des niveaux
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide)
+*/
+void comparer_heuristiques(int nbFichiers, char *fichiers[],
+    t_motifs *motifs)
+{
+    t_plateau plateau;
+    t_statsSolveur stats;
+    t_optionsSolveur options;
+    long totalNoeuds[NB_REGLAGES] = {0};
+    double totalDuree[NB_REGLAGES] = {0};
+    double duree;
+
+    options_par_defaut(&options);
+    printf("%-24s %-15s %10s %10s %8s %10s\n", "niveau", "heuristique",
+        "explorés", "créés", "poussées", "temps (ms)");
+
+    for(int i = 0 ; i < nbFichiers ; i++){
+        charger_partie(plateau, fichiers[i]);
+
+        for(int num = 0 ; num < NB_REGLAGES ; num++){
+            options.heuristique = HEURISTIQUES[num];
+            options.macros = MACROS[num];
+            options.bidirectionnel = BIDIRECTIONNEL[num];
+            options.motifs = MOTIFS[num] && motifs->bits != NULL ?
+                motifs : NULL;
+            duree = mesurer_resolution(plateau, &options, &stats);
+            totalNoeuds[num] += stats.noeudsExplores;
+            totalDuree[num] += duree;
+
+            printf("%-24s %-15s %10ld %10ld %8d %10.2f\n", fichiers[i],
+                NOMS_REGLAGES[num], stats.noeudsExplores,
+                stats.noeudsCrees, stats.trouve ? stats.nbPoussees : -1,
+                duree);
+        }
+    }
+
+    for(int num = 0 ; num < NB_REGLAGES ; num++){
+        printf("%-24s %-15s %10ld %10s %8s %10.2f\n", "TOTAL",
+            NOMS_REGLAGES[num], totalNoeuds[num], "", "", totalDuree[num]);
+    }
+}
+
+/**
+*
+* @brief Raccourcir les déplacements d'un fichier et écrire le résultat
+* @param fichier de type chaîne de caractères, Entrée : fichier du niveau
+* @param fichierEntree de type chaîne de caractères, Entrée : déplacements
+*   enregistrés
+* @param fichierSortie de type chaîne de caractères, Entrée : fichier où
+*   écrire les déplacements raccourcis
+* @return vrai si les déplacements ont été lus et réécrits
+*/
+bool optimiser_fichier(char fichier[], char fichierEntree[],
+    char fichierSortie[])
+{
+    t_plateau plateau;
+    t_statsOptimisation stats;
+    char deplacements[TAILLE_SOLUTION_MAX];
+    char solution[TAILLE_SOLUTION_MAX];
+    int nbDeplacements = 0;
+    bool reussi = false;
+    FILE *entree = fopen(fichierEntree, "r");
+
+    if(entree == NULL){
+        printf("Impossible de lire %s\n", fichierEntree);
+    }
+    else{
+        nbDeplacements = fread(deplacements, sizeof(char),
+            TAILLE_SOLUTION_MAX - 1, entree);
+        fclose(entree);
+
+        charger_partie(plateau, fichier);
+        reussi = optimiser_deplacements(plateau, deplacements,
+            nbDeplacements, solution, &stats);
+    }
+
+    if(reussi){
+        enregistrer_deplacements(solution, stats.deplacements[1],
+            fichierSortie);
+        printf("Avant : %d déplacements, %d poussées\n",
+            stats.deplacements[0], stats.poussees[0]);
+        printf("Après : %d déplacements, %d poussées\n",
+            stats.deplacements[1], stats.poussees[1]);
+        printf("%d poussées en boucle retirées, %d raccourcis, %d tours "
+            "sur %d threads\n", stats.boucles, stats.raccourcis, stats.tours,
+            stats.nbThreads);
+    }
+
+    return reussi;
+}
+
+/**
+*
+* @brief Charger et canoniser les fichiers d'un lot (fonction de thread)
+* @param argument de type t_lot*, Entrée/Sortie : fichiers à traiter,
+*   formes et empreintes calculées
+* @return pointeur : NULL
+*/
+void *canoniser_fichiers(void *argument)
+{
+    t_lot *lot = argument;
+    t_plateau plateau;
+
+    for(int i = lot->premier ; i < lot->nbFichiers ; i += lot->pas){
+        charger_partie(plateau, lot->fichiers[i]);
+        canoniser_plateau(plateau, &lot->formes[i]);
+        lot->empreintes[i] = hacher_forme(&lot->formes[i]);
+    }
+
+    return NULL;
+}
+
+/**
+*
+* @brief Ordonner deux empreintes pour qsort (empreinte, puis fichier)
+* @param empreinteA de type t_empreinte*, Entrée : première empreinte
+* @param empreinteB de type t_empreinte*, Entrée : seconde empreinte
+* @return entier : négatif, nul ou positif
+*/
+int ordonner_empreintes(const void *empreinteA, const void *empreinteB)
+{
+    const t_empreinte *premiere = empreinteA;
+    const t_empreinte *seconde = empreinteB;
+    int ordre;
+
+    if(premiere->empreinte != seconde->empreinte){
+        ordre = premiere->empreinte < seconde->empreinte ? -1 : 1;
+    }
+    else{
+        ordre = premiere->indice - seconde->indice;
+    }
+
+    return ordre;
+}
+
+/**
+*
+* @brief Afficher les niveaux en double d'une collection
+* @param nbFichiers de type entier, Entrée : nombre de fichiers
+* @param fichiers de type tableau de chaînes, Entrée : fichiers des niveaux
+*/
+void chercher_doublons(int nbFichiers, char *fichiers[])
+{
+    t_forme *formes = malloc(sizeof(t_forme) * nbFichiers);
+    uint64_t *empreintes = malloc(sizeof(uint64_t) * nbFichiers);
+    t_empreinte *triees = malloc(sizeof(t_empreinte) * nbFichiers);
+    int *original = malloc(sizeof(int) * nbFichiers);
+    pthread_t threads[THREADS_MAX];
+    t_lot lots[THREADS_MAX];
+    int nbThreads = nombre_threads();
+    int debut = 0, modele, nbDoublons = 0;
+
+    for(int i = 0 ; i < nbThreads ; i++){
+        lots[i] = (t_lot){fichiers, nbFichiers, i, nbThreads, formes,
+            empreintes};
+        pthread_create(&threads[i], NULL, canoniser_fichiers, &lots[i]);
+    }
+    for(int i = 0 ; i < nbThreads ; i++){
+        pthread_join(threads[i], NULL);
+    }
+
+    for(int i = 0 ; i < nbFichiers ; i++){
+        triees[i] = (t_empreinte){empreintes[i], i};
+        original[i] = i;
+    }
+    qsort(triees, nbFichiers, sizeof(t_empreinte), ordonner_empreintes);
+
+    // Dans une même empreinte, chaque fichier est rattaché au premier
+    // fichier de forme identique (les collisions restent séparées)
+    for(int i = 1 ; i <= nbFichiers ; i++){
+        if(i == nbFichiers || triees[i].empreinte != triees[debut].empreinte){
+            for(int j = debut + 1 ; j < i ; j++){
+                modele = debut;
+                while(modele < j && !formes_egales(&formes[triees[j].indice],
+                    &formes[triees[modele].indice])){
+                    modele++;
+                }
+                original[triees[j].indice] = original[triees[modele].indice];
+            }
+            debut = i;
+        }
+    }
+
+    for(int i = 0 ; i < nbFichiers ; i++){
+        if(original[i] != i){
+            printf("%s : doublon de %s\n", fichiers[i],
+                fichiers[original[i]]);
+            nbDoublons++;
+        }
+    }
+    printf("%d niveaux, %d distincts, %d doublons (%d threads)\n",
+        nbFichiers, nbFichiers - nbDoublons, nbDoublons, nbThreads);
+
+    free(formes);
+    free(empreintes);
+    free(triees);
+    free(original);
+}
+
+/**
+*
+* @brief Générer des niveaux et les écrire dans un dossier
+*   (genere_00001.sok, ...), avec la note de chacun
+* @param nbNiveaux de type entier, Entrée : nombre de niveaux
+* @param dossier de type chaîne de caractères, Entrée : dossier de sortie
+*   (créé s'il n'existe pas)
+* @param graine de type entier 64 bits, Entrée : graine de la série
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide)
+* @return vrai si les niveaux ont été écrits
+*/
+bool generer_fichiers(int nbNiveaux, char dossier[], uint64_t graine,
+    t_motifs *motifs)
+{
+    t_niveauGenere *niveaux = NULL;
+    t_statsGeneration stats;
+    struct timespec debut, fin;
+    char chemin[TAILLE_CHEMIN];
+    int nbEcrits = 0;
+    double duree;
+    bool reussi;
+
+    mkdir(dossier, 0755);
+    reussi = nbNiveaux > 0 && access(dossier, W_OK) == 0;
+    if(reussi){
+        niveaux = malloc(sizeof(t_niveauGenere) * nbNiveaux);
+        clock_gettime(CLOCK_MONOTONIC, &debut);
+        generer_niveaux(niveaux, nbNiveaux, graine,
+            motifs->bits != NULL ? motifs : NULL, &stats);
+        clock_gettime(CLOCK_MONOTONIC, &fin);
+        duree = (fin.tv_sec - debut.tv_sec) +
+            (fin.tv_nsec - debut.tv_nsec) / 1e9;
+    }
+    else{
+        printf("Impossible d'écrire dans %s\n", dossier);
+    }
+
+    for(int i = 0 ; reussi && i < nbNiveaux ; i++){
+        if(niveaux[i].reussi){
+            snprintf(chemin, sizeof(chemin), "%s/genere_%05d.sok", dossier,
+                i + 1);
+            enregistrer_partie(niveaux[i].plateau, chemin);
+            printf("%s : %d poussées, %d déplacements\n", chemin,
+                niveaux[i].nbPoussees, niveaux[i].nbDeplacements);
+            nbEcrits++;
+        }
+    }
+
+    if(reussi){
+        printf("%d niveaux sur %d en %.2f s (%.0f par minute), %ld essais, "
+            "%d threads, graine %llu\n", nbEcrits, nbNiveaux, duree,
+            nbEcrits * 60 / (duree > 0 ? duree : 1e-9), stats.essais,
+            stats.nbThreads, (unsigned long long)graine);
+    }
+    free(niveaux);
+
+    return reussi;
+}
+
+/**
+*
+* @brief Estimer la difficulté d'une collection et écrire ses métadonnées
+* @param fichierSortie de type chaîne de caractères, Entrée : fichier des
+*   métadonnées (voir ecrire_difficultes)
+* @param nbFichiers de type entier, Entrée : nombre de fichiers
+* @param fichiers de type tableau de chaînes, Entrée : fichiers des niveaux
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide)
+* @return vrai si le fichier a été écrit
+*/
+bool classer_difficulte(char fichierSortie[], int nbFichiers,
+    char *fichiers[], t_motifs *motifs)
+{
+    t_difficulte *difficultes = malloc(sizeof(t_difficulte) * nbFichiers);
+    struct timespec debut, fin;
+    int nbThreads, nbResolus = 0;
+    bool reussi;
+
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    nbThreads = estimer_collection(fichiers, nbFichiers,
+        motifs->bits != NULL ? motifs : NULL, difficultes);
+    clock_gettime(CLOCK_MONOTONIC, &fin);
+
+    for(int i = 0 ; i < nbFichiers ; i++){
+        nbResolus += difficultes[i].resolu;
+    }
+    reussi = ecrire_difficultes(fichierSortie, fichiers, difficultes,
+        nbFichiers);
+    if(reussi){
+        printf("%d niveaux notés (%d résolus) en %.2f s sur %d threads : "
+            "%s\n", nbFichiers, nbResolus, (fin.tv_sec - debut.tv_sec) +
+            (fin.tv_nsec - debut.tv_nsec) / 1e9, nbThreads, fichierSortie);
+    }
+    else{
+        printf("Impossible d'écrire %s\n", fichierSortie);
+    }
+    free(difficultes);
+
+    return reussi;
+}
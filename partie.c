@@ -0,0 +1,91 @@
+/**
+* @file partie.c
+* @brief Coups du joueur pendant une partie dans le terminal
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Chaque coup passe par le moteur (voir moteur.h), puis le jeu prévient si
+* une caisse ne peut plus atteindre de cible.
+*/
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+#include "partie.h"
+
+/* Fonctions internes */
+
+void verifier_poussee(t_partie *jeu, int depX, int depY);
+
+/**
+*
+* @brief Déplacer le joueur (voir moteur.h)
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+* @param depX de type entier, Entrée : déplacement vertical
+* @param depY de type entier, Entrée : déplacement horizontal
+*/
+void jouer_coup(t_partie *jeu, int depX, int depY)
+{
+    t_resultatDeplacement resultat = deplacer(&jeu->moteur, depX, depY);
+
+    noter_deplacement(jeu->enregistrement, depX, depY, resultat);
+    if(resultat == DEPLACEMENT_POUSSEE){
+        verifier_poussee(jeu, depX, depY);
+    }
+}
+
+/**
+*
+* @brief Prévenir si la caisse qui vient d'être poussée ne pourra plus
+*   jamais atteindre une cible
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+* @param depX de type entier, Entrée : sens vertical de la poussée
+* @param depY de type entier, Entrée : sens horizontal de la poussée
+*/
+void verifier_poussee(t_partie *jeu, int depX, int depY)
+{
+    int ligne = jeu->moteur.joueur.posX + depX;
+    int colonne = jeu->moteur.joueur.posY + depY;
+
+    if(jeu->coupBloquant < 0 &&
+        caisse_bloquee(&jeu->motifs, jeu->moteur.plateau, ligne, colonne)){
+        jeu->coupBloquant = jeu->moteur.deplacements.nbDeplacements - 1;
+    }
+}
+
+/**
+*
+* @brief Pousser la dernière caisse jusqu'au bout de son couloir
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*/
+void pousser_jusqu_au_bout(t_partie *jeu)
+{
+    t_joueur depart = jeu->moteur.joueur;
+    int nbPoussees = traverser_couloir(&jeu->moteur);
+
+    noter_evenement(jeu->enregistrement, EVENEMENT_COULOIR, nbPoussees);
+    // Toutes les poussées vont dans le même sens
+    if(nbPoussees > 0){
+        verifier_poussee(jeu,
+            (jeu->moteur.joueur.posX - depart.posX) / nbPoussees,
+            (jeu->moteur.joueur.posY - depart.posY) / nbPoussees);
+    }
+}
+
+/**
+*
+* @brief Annuler le dernier déplacement, s'il y en a un
+* @param jeu de type t_partie, Entrée/Sortie : structure de la partie
+*/
+void annuler_coup(t_partie *jeu)
+{
+    bool annule = retour_arriere(&jeu->moteur);
+
+    noter_evenement(jeu->enregistrement, EVENEMENT_ANNULATION, annule);
+    // La poussée qui avait bloqué une caisse vient d'être annulée
+    if(annule &&
+        jeu->coupBloquant >= jeu->moteur.deplacements.nbDeplacements){
+        jeu->coupBloquant = -1;
+    }
+}
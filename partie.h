@@ -0,0 +1,73 @@
+/**
+* @file partie.h
+* @brief Partie en cours dans le terminal et coups du joueur
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* La partie regroupe le plateau, le joueur et tout ce que le jeu garde
+* autour : vue affichée (voir affichage.h), interblocages, conseil et
+* vérification en arrière-plan. Le jeu (main.c) joue les coups du joueur
+* par ces fonctions.
+*/
+
+#ifndef PARTIE_H
+#define PARTIE_H
+
+#include <stdbool.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "motifs.h"
+#include "conseil.h"
+#include "surveillance.h"
+#include "cache.h"
+#include "trace.h"
+#include "scores.h"
+#include "enregistrement.h"
+
+#define TAILLE_NOM_FICHIER  256
+#define ZOOM_MIN            1
+#define ZOOM_MAX            3
+
+// Structure vue : fenêtre du plateau affichée (en cases)
+typedef struct {
+    int lignesTerminal;
+    int colonnesTerminal;
+    int premiereLigne;
+    int premiereColonne;
+    int nbLignes;
+    int nbColonnes;
+} t_vue;
+
+// Structure partie
+typedef struct {
+    bool estFinis; // est ce que le jeu est finis, pour la boucle
+    char nomFichier[TAILLE_NOM_FICHIER]; // nom du fichier de jeu
+    int zoom; // niveau de zoom 1 2 3
+    int tentatives; // nombre de tentatives (quand on recommence : tentative ++)
+    long debutTentative; // horloge (ns) du dernier départ du niveau
+    t_moteur moteur; // plateau, joueur et déplacements (voir moteur.h)
+    t_vue vue;
+    t_motifs motifs; // base d'interblocages (voir motifs.h)
+    t_cache cache; // solutions déjà trouvées (voir cache.h)
+    t_scores scores; // records de chaque niveau (voir scores.h)
+    int coupBloquant; // poussée qui a bloqué une caisse, -1 si aucune
+    t_conseil conseil; // plan du dernier conseil (voir conseil.h)
+    t_poussee pousseeConseillee; // caisse à -1 si aucune n'est trouvée
+    int coupConseil; // déplacements au moment du conseil, -1 si aucun
+    t_surveillance *surveillance; // vérification en arrière-plan
+    t_plateau plateauSurveille; // dernière position envoyée à vérifier
+    t_verdict resolubilite; // verdict affiché
+    bool verificationEnCours;
+    t_trace trace; // étapes de la boucle, si SOKOBAN_TRACE est donné
+    t_enregistrement *enregistrement; // NULL si la session n'est pas notée
+    bool imageEnRetard; // l'affichage ne montre pas l'état actuel
+    long derniereImage; // horloge (ns) du dernier affichage
+} t_partie;
+
+void jouer_coup(t_partie *jeu, int depX, int depY);
+void pousser_jusqu_au_bout(t_partie *jeu);
+void annuler_coup(t_partie *jeu);
+
+#endif
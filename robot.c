@@ -0,0 +1,228 @@
+/**
+* @file robot.c
+* @brief Protocole binaire des robots (voir robot.h)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Une lecture du socket peut contenir plusieurs requêtes, ou une partie
+* seulement : les octets reçus s'accumulent dans l'entrée de la session et
+* chaque requête complète est traitée, tant que sa réponse la plus longue
+* tient dans la sortie. Sinon, la session attend que le client lise.
+*/
+
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/socket.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "robot.h"
+#include "serveur.h"
+
+// Directions dans l'ordre de t_coupRobot
+const int ROBOT_DEP_X[4] = {-1, 1, 0, 0};
+const int ROBOT_DEP_Y[4] = {0, 0, -1, 1};
+
+/* Fonctions internes */
+
+void traiter_requetes(t_session *session);
+int longueur_requete(const unsigned char requete[], int disponible);
+void executer_requete(t_session *session, const unsigned char requete[]);
+unsigned char jouer_coups(t_session *session, const unsigned char coups[],
+    int nombre, unsigned char resultats[]);
+void ecrire_etat(t_session *session, unsigned char etat[], bool avecPlateau);
+
+/**
+*
+* @brief Lire les requêtes du robot et y répondre
+* @param session de type t_session, Entrée/Sortie : session robot
+*/
+void lire_robot(t_session *session)
+{
+    ssize_t nbLus = 1;
+
+    // Requêtes laissées en attente faute de place dans la sortie
+    traiter_requetes(session);
+    while(nbLus > 0 && !session->fermer &&
+        session->finEntree < ROBOT_REQUETE_MAX &&
+        place_sortie(session) >= ROBOT_REPONSE_MAX){
+        nbLus = recv(session->socket, &session->entree[session->finEntree],
+            ROBOT_REQUETE_MAX - session->finEntree, 0);
+        if(nbLus > 0){
+            session->finEntree += nbLus;
+            traiter_requetes(session);
+        }
+    }
+
+    // 0 : le client s'est déconnecté
+    if(nbLus == 0 || (nbLus < 0 && errno != EAGAIN &&
+        errno != EWOULDBLOCK && errno != EINTR)){
+        session->fermer = true;
+    }
+}
+
+/**
+*
+* @brief Traiter les requêtes complètes de l'entrée et garder la suite
+* @param session de type t_session, Entrée/Sortie : session robot
+* Une requête mal formée ferme la session : la suite serait illisible
+*/
+void traiter_requetes(t_session *session)
+{
+    int debut = 0;
+    int longueur = longueur_requete(session->entree, session->finEntree);
+
+    while(longueur > 0 && place_sortie(session) >= ROBOT_REPONSE_MAX){
+        executer_requete(session, &session->entree[debut]);
+        debut += longueur;
+        longueur = longueur_requete(&session->entree[debut],
+            session->finEntree - debut);
+    }
+
+    if(longueur < 0){
+        session->fermer = true;
+    }
+    memmove(session->entree, &session->entree[debut],
+        session->finEntree - debut);
+    session->finEntree -= debut;
+}
+
+/**
+*
+* @brief Longueur de la requête au début des octets reçus
+* @param requete de type tableau d'octets, Entrée : octets reçus
+* @param disponible de type entier, Entrée : nombre d'octets reçus
+* @return entier : longueur, 0 si la requête est incomplète, -1 si elle
+*   est mal formée
+*/
+int longueur_requete(const unsigned char requete[], int disponible)
+{
+    int longueur = 0;
+    int nombre;
+
+    if(disponible >= ROBOT_ENTETE){
+        nombre = requete[2] | requete[3] << 8;
+        longueur = ROBOT_ENTETE + nombre;
+        if(requete[0] == REQUETE_NIVEAU){
+            longueur = nombre < TAILLE_NOM_NIVEAU ? longueur : -1;
+        }
+        else if(requete[0] != REQUETE_COUPS || nombre > ROBOT_COUPS_MAX){
+            longueur = -1;
+        }
+        if(longueur > disponible){
+            longueur = 0;
+        }
+    }
+
+    return longueur;
+}
+
+/**
+*
+* @brief Exécuter une requête complète et écrire sa réponse
+* @param session de type t_session, Entrée/Sortie : session robot
+* @param requete de type tableau d'octets, Entrée : requête (en-tête et
+*   données)
+*/
+void executer_requete(t_session *session, const unsigned char requete[])
+{
+    int nombre = requete[2] | requete[3] << 8;
+    bool avecPlateau = requete[1] & ROBOT_PLATEAU;
+    int nbResultats = requete[0] == REQUETE_COUPS ? nombre : 0;
+    // La place a été vérifiée : la réservation ne peut pas échouer
+    unsigned char *reponse = reserver_sortie(session, ROBOT_ENTETE +
+        nbResultats + ROBOT_ETAT + (avecPlateau ? TAILLE * TAILLE : 0));
+    unsigned char etat = avecPlateau ? ROBOT_PLATEAU : 0;
+    char nom[TAILLE_NOM_NIVEAU];
+
+    if(requete[0] == REQUETE_NIVEAU){
+        memcpy(nom, &requete[ROBOT_ENTETE], nombre);
+        nom[nombre] = '\0';
+        if(!charger_niveau_session(session, nom)){
+            etat |= ROBOT_ERREUR;
+        }
+    }
+    else{
+        etat |= jouer_coups(session, &requete[ROBOT_ENTETE], nombre,
+            &reponse[ROBOT_ENTETE]);
+    }
+
+    if(session->niveau[0] != '\0' && gagne(&session->moteur)){
+        etat |= ROBOT_GAGNE;
+    }
+    reponse[0] = requete[0];
+    reponse[1] = etat;
+    reponse[2] = nbResultats & 0xFF;
+    reponse[3] = nbResultats >> 8;
+    ecrire_etat(session, &reponse[ROBOT_ENTETE + nbResultats], avecPlateau);
+}
+
+/**
+*
+* @brief Jouer un lot de commandes et noter le résultat de chacune
+* @param session de type t_session, Entrée/Sortie : session robot
+* @param coups de type tableau d'octets, Entrée : commandes (t_coupRobot)
+* @param nombre de type entier, Entrée : nombre de commandes
+* @param resultats de type tableau d'octets, Sortie : résultat de chaque
+*   commande (t_resultatDeplacement)
+* @return octet : ROBOT_ERREUR si une commande est inconnue ou si aucun
+*   niveau n'est chargé, 0 sinon
+*/
+unsigned char jouer_coups(t_session *session, const unsigned char coups[],
+    int nombre, unsigned char resultats[])
+{
+    t_moteur *moteur = &session->moteur;
+    bool charge = session->niveau[0] != '\0';
+    unsigned char erreur = charge ? 0 : ROBOT_ERREUR;
+
+    for(int i = 0 ; i < nombre ; i++){
+        resultats[i] = DEPLACEMENT_IMPOSSIBLE;
+        if(!charge || coups[i] > COUP_POUSSER){
+            erreur = ROBOT_ERREUR;
+        }
+        else if(coups[i] <= COUP_DROITE){
+            resultats[i] = deplacer(moteur, ROBOT_DEP_X[coups[i]],
+                ROBOT_DEP_Y[coups[i]]);
+        }
+        else if(coups[i] == COUP_ANNULER){
+            resultats[i] = retour_arriere(moteur) ? DEPLACEMENT_SIMPLE :
+                DEPLACEMENT_IMPOSSIBLE;
+        }
+        else if(coups[i] == COUP_RECOMMENCER){
+            memcpy(moteur->plateau, session->depart, sizeof(t_plateau));
+            demarrer_niveau(moteur);
+            resultats[i] = DEPLACEMENT_SIMPLE;
+        }
+        else{
+            resultats[i] = traverser_couloir(moteur) > 0 ?
+                DEPLACEMENT_POUSSEE : DEPLACEMENT_IMPOSSIBLE;
+        }
+    }
+
+    return erreur;
+}
+
+/**
+*
+* @brief Écrire l'état de la partie : joueur, déplacements et plateau
+* @param session de type t_session, Entrée : session robot
+* @param etat de type tableau d'octets, Sortie : ROBOT_ETAT octets, plus
+*   TAILLE x TAILLE si le plateau est demandé
+* @param avecPlateau de type booléen, Entrée : joindre le plateau
+*/
+void ecrire_etat(t_session *session, unsigned char etat[], bool avecPlateau)
+{
+    t_moteur *moteur = &session->moteur;
+    int nbDeplacements = moteur->deplacements.nbDeplacements;
+
+    etat[0] = moteur->joueur.posX;
+    etat[1] = moteur->joueur.posY;
+    for(int i = 0 ; i < 4 ; i++){
+        etat[2 + i] = (nbDeplacements >> (8 * i)) & 0xFF;
+    }
+    if(avecPlateau){
+        memcpy(&etat[ROBOT_ETAT], moteur->plateau, TAILLE * TAILLE);
+    }
+}
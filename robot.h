@@ -0,0 +1,60 @@
+/**
+* @file robot.h
+* @brief Protocole binaire des robots : des lots de coups sans affichage
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Avec serveur --robots, chaque connexion parle ce protocole au lieu des
+* touches du terminal. Une requête est un en-tête de ROBOT_ENTETE octets
+* (type, options, nombre sur 2 octets petit-boutiste) suivi de nombre
+* octets :
+*  - REQUETE_NIVEAU : le nom d'un niveau du dossier des niveaux ;
+*  - REQUETE_COUPS : jusqu'à ROBOT_COUPS_MAX commandes (t_coupRobot).
+*
+* La réponse reprend le type et le nombre, indique dans l'octet d'état si
+* la partie est gagnée ou si la requête est fautive, puis donne le
+* résultat de chaque commande (t_resultatDeplacement), la ligne et la
+* colonne du joueur, le nombre de déplacements (4 octets petit-boutiste)
+* et, si l'option ROBOT_PLATEAU est demandée, les TAILLE x TAILLE cases.
+* Un client peut envoyer plusieurs requêtes sans attendre les réponses :
+* elles sont traitées dans l'ordre.
+*/
+
+#ifndef ROBOT_H
+#define ROBOT_H
+
+#include "sokoban.h"
+
+#define FICHIER_SOCKET_ROBOTS   "bin/robots.sock"
+#define ROBOT_ENTETE            4
+#define ROBOT_COUPS_MAX         4096
+#define ROBOT_ETAT              6   // ligne, colonne, déplacements
+#define ROBOT_REQUETE_MAX       (ROBOT_ENTETE + ROBOT_COUPS_MAX)
+#define ROBOT_REPONSE_MAX       (ROBOT_ENTETE + ROBOT_COUPS_MAX + \
+                                 ROBOT_ETAT + TAILLE * TAILLE)
+
+/* Options de la requête et état de la réponse (2e octet) */
+
+#define ROBOT_PLATEAU   1   // joindre le plateau à la réponse
+#define ROBOT_GAGNE     2
+#define ROBOT_ERREUR    4   // niveau introuvable, commande inconnue...
+
+// Type d'une requête (1er octet)
+typedef enum {
+    REQUETE_NIVEAU = 'N',
+    REQUETE_COUPS = 'C'
+} t_requeteRobot;
+
+// Commande d'un lot de coups (directions dans l'ordre du solveur)
+typedef enum {
+    COUP_HAUT,
+    COUP_BAS,
+    COUP_GAUCHE,
+    COUP_DROITE,
+    COUP_ANNULER,       // résultat : DEPLACEMENT_SIMPLE si annulé
+    COUP_RECOMMENCER,   // résultat : DEPLACEMENT_SIMPLE
+    COUP_POUSSER        // jusqu'au bout du couloir (DEPLACEMENT_POUSSEE)
+} t_coupRobot;
+
+#endif
@@ -0,0 +1,451 @@
+/**
+* @file scores.c
+* @brief Statistiques par niveau et classement des meilleures parties
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le journal est lu et écrit par descripteur (pread, write en ajout) :
+* sans tampon de FILE, les victoires écrites par un autre processus sont
+* vues dès qu'il rend le verrou.
+*/
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+#include "canonique.h"
+#include "scores.h"
+
+#define SCORES_SIGNATURE        "SKSR"
+#define NIVEAUX_INITIAUX        64
+#define VICTOIRES_PAR_LECTURE   256
+
+/* Fonctions internes */
+
+long place_niveau(t_scores *scores, uint64_t empreinte);
+void agrandir_scores(t_scores *scores);
+bool meilleure_partie(t_victoire *victoire, t_victoire *autre);
+void noter_records(t_statsNiveau *stats, t_victoire *victoire);
+void classer_victoire(t_statsNiveau *stats, t_victoire *victoire);
+void ranger_victoire(t_scores *scores, t_victoire *victoire);
+void coder_entier(unsigned char octets[], uint64_t valeur, int nbOctets);
+uint64_t decoder_entier(const unsigned char octets[], int nbOctets);
+void coder_victoire(t_victoire *victoire, unsigned char octets[]);
+void decoder_victoire(const unsigned char octets[], t_victoire *victoire);
+bool rattraper_scores(t_scores *scores, bool reparer);
+
+/**
+*
+* @brief Calculer l'empreinte d'un niveau (forme canonique de son départ)
+* @param plateau de type t_plateau, Entrée : niveau au départ
+* @return entier 64 bits : empreinte
+*/
+uint64_t empreinte_niveau(t_plateau plateau)
+{
+    t_forme forme;
+
+    canoniser_plateau(plateau, &forme);
+
+    return hacher_forme(&forme);
+}
+
+/**
+*
+* @brief Trouver la place d'un niveau dans la table
+* @param scores de type t_scores, Entrée : statistiques
+* @param empreinte de type entier 64 bits, Entrée : empreinte du niveau
+* @return entier long : place du niveau, ou place libre où le ranger
+*/
+long place_niveau(t_scores *scores, uint64_t empreinte)
+{
+    long masque = scores->tailleTable - 1;
+    long place = (long)(empreinte & (uint64_t)masque);
+
+    while(scores->table[place] != 0 &&
+        scores->niveaux[scores->table[place] - 1].empreinte != empreinte){
+        place = (place + 1) & masque;
+    }
+
+    return place;
+}
+
+/**
+*
+* @brief Doubler la table et le tableau des niveaux
+* @param scores de type t_scores, Entrée/Sortie : statistiques
+*/
+void agrandir_scores(t_scores *scores)
+{
+    scores->capacite *= 2;
+    scores->niveaux = realloc(scores->niveaux,
+        sizeof(t_statsNiveau) * scores->capacite);
+
+    free(scores->table);
+    scores->tailleTable *= 2;
+    scores->table = calloc(scores->tailleTable, sizeof(long));
+
+    for(long i = 0 ; i < scores->nbNiveaux ; i++){
+        scores->table[place_niveau(scores, scores->niveaux[i].empreinte)] =
+            i + 1;
+    }
+}
+
+/**
+*
+* @brief Comparer deux parties du classement
+* @param victoire de type t_victoire, Entrée : partie à classer
+* @param autre de type t_victoire, Entrée : partie déjà classée
+* @return vrai si la partie fait strictement mieux (déplacements, puis
+*   poussées, puis durée)
+*/
+bool meilleure_partie(t_victoire *victoire, t_victoire *autre)
+{
+    bool meilleure;
+
+    if(victoire->nbDeplacements != autre->nbDeplacements){
+        meilleure = victoire->nbDeplacements < autre->nbDeplacements;
+    }
+    else if(victoire->nbPoussees != autre->nbPoussees){
+        meilleure = victoire->nbPoussees < autre->nbPoussees;
+    }
+    else{
+        meilleure = victoire->duree < autre->duree;
+    }
+
+    return meilleure;
+}
+
+/**
+*
+* @brief Améliorer les records d'un niveau avec une victoire
+* @param stats de type t_statsNiveau, Entrée/Sortie : statistiques du
+*   niveau
+* @param victoire de type t_victoire, Entrée : victoire
+*/
+void noter_records(t_statsNiveau *stats, t_victoire *victoire)
+{
+    stats->nbVictoires++;
+    if(victoire->nbDeplacements < stats->meilleursDeplacements){
+        stats->meilleursDeplacements = victoire->nbDeplacements;
+    }
+    if(victoire->nbPoussees < stats->meilleuresPoussees){
+        stats->meilleuresPoussees = victoire->nbPoussees;
+    }
+    if(victoire->duree < stats->meilleureDuree){
+        stats->meilleureDuree = victoire->duree;
+    }
+    if(victoire->tentatives < stats->moinsTentatives){
+        stats->moinsTentatives = victoire->tentatives;
+    }
+}
+
+/**
+*
+* @brief Insérer une victoire dans le classement du niveau, si elle y a
+*   sa place
+* @param stats de type t_statsNiveau, Entrée/Sortie : statistiques du
+*   niveau
+* @param victoire de type t_victoire, Entrée : victoire
+*/
+void classer_victoire(t_statsNiveau *stats, t_victoire *victoire)
+{
+    int rang = stats->nbClasses;
+
+    // Les parties moins bonnes descendent (la dernière sort si c'est plein)
+    while(rang > 0 && meilleure_partie(victoire,
+        &stats->classement[rang - 1])){
+        if(rang < SCORES_CLASSEMENT){
+            stats->classement[rang] = stats->classement[rang - 1];
+        }
+        rang--;
+    }
+
+    if(rang < SCORES_CLASSEMENT){
+        stats->classement[rang] = *victoire;
+        if(stats->nbClasses < SCORES_CLASSEMENT){
+            stats->nbClasses++;
+        }
+    }
+}
+
+/**
+*
+* @brief Ranger une victoire dans la table (le niveau est créé s'il est
+*   nouveau)
+* @param scores de type t_scores, Entrée/Sortie : statistiques
+* @param victoire de type t_victoire, Entrée : victoire
+*/
+void ranger_victoire(t_scores *scores, t_victoire *victoire)
+{
+    t_statsNiveau *stats;
+    long place;
+
+    if(scores->nbNiveaux * 2 >= scores->tailleTable){
+        agrandir_scores(scores);
+    }
+    place = place_niveau(scores, victoire->empreinte);
+
+    if(scores->table[place] == 0){
+        stats = &scores->niveaux[scores->nbNiveaux];
+        memset(stats, 0, sizeof(t_statsNiveau));
+        stats->empreinte = victoire->empreinte;
+        stats->meilleursDeplacements = INT_MAX;
+        stats->meilleuresPoussees = INT_MAX;
+        stats->meilleureDuree = LONG_MAX;
+        stats->moinsTentatives = INT_MAX;
+        scores->table[place] = ++scores->nbNiveaux;
+    }
+    else{
+        stats = &scores->niveaux[scores->table[place] - 1];
+    }
+
+    noter_records(stats, victoire);
+    classer_victoire(stats, victoire);
+}
+
+/**
+*
+* @brief Écrire un entier positif en petit-boutiste
+* @param octets de type tableau d'octets, Sortie : octets écrits
+* @param valeur de type entier 64 bits, Entrée : valeur
+* @param nbOctets de type entier, Entrée : nombre d'octets (8 au plus)
+*/
+void coder_entier(unsigned char octets[], uint64_t valeur, int nbOctets)
+{
+    for(int i = 0 ; i < nbOctets ; i++){
+        octets[i] = (valeur >> (8 * i)) & 0xFF;
+    }
+}
+
+/**
+*
+* @brief Lire un entier positif écrit en petit-boutiste
+* @param octets de type tableau d'octets, Entrée : octets lus
+* @param nbOctets de type entier, Entrée : nombre d'octets (8 au plus)
+* @return entier 64 bits : valeur
+*/
+uint64_t decoder_entier(const unsigned char octets[], int nbOctets)
+{
+    uint64_t valeur = 0;
+
+    for(int i = nbOctets - 1 ; i >= 0 ; i--){
+        valeur = (valeur << 8) | octets[i];
+    }
+
+    return valeur;
+}
+
+/**
+*
+* @brief Écrire une victoire au format du journal (voir scores.h)
+* @param victoire de type t_victoire, Entrée : victoire
+* @param octets de type tableau d'octets, Sortie : SCORES_TAILLE_VICTOIRE
+*   octets
+*/
+void coder_victoire(t_victoire *victoire, unsigned char octets[])
+{
+    unsigned char *valeurs = &octets[8 + TAILLE_JOUEUR];
+
+    coder_entier(octets, victoire->empreinte, 8);
+    memset(&octets[8], '\0', TAILLE_JOUEUR);
+    memcpy(&octets[8], victoire->joueur,
+        strnlen(victoire->joueur, TAILLE_JOUEUR - 1));
+    coder_entier(valeurs, victoire->nbDeplacements, 4);
+    coder_entier(&valeurs[4], victoire->nbPoussees, 4);
+    coder_entier(&valeurs[8], victoire->duree, 4);
+    coder_entier(&valeurs[12], victoire->tentatives, 4);
+    coder_entier(&valeurs[16], victoire->date, 8);
+}
+
+/**
+*
+* @brief Lire une victoire au format du journal (voir scores.h)
+* @param octets de type tableau d'octets, Entrée : SCORES_TAILLE_VICTOIRE
+*   octets
+* @param victoire de type t_victoire, Sortie : victoire
+*/
+void decoder_victoire(const unsigned char octets[], t_victoire *victoire)
+{
+    const unsigned char *valeurs = &octets[8 + TAILLE_JOUEUR];
+
+    victoire->empreinte = decoder_entier(octets, 8);
+    memcpy(victoire->joueur, &octets[8], TAILLE_JOUEUR);
+    victoire->joueur[TAILLE_JOUEUR - 1] = '\0';
+    victoire->nbDeplacements = decoder_entier(valeurs, 4);
+    victoire->nbPoussees = decoder_entier(&valeurs[4], 4);
+    victoire->duree = decoder_entier(&valeurs[8], 4);
+    victoire->tentatives = decoder_entier(&valeurs[12], 4);
+    victoire->date = decoder_entier(&valeurs[16], 8);
+}
+
+/**
+*
+* @brief Ranger les victoires ajoutées au fichier depuis la dernière
+*   lecture (le verrou du fichier doit être pris)
+* @param scores de type t_scores, Entrée/Sortie : statistiques
+* @param reparer de type booléen, Entrée : retirer une victoire incomplète
+*   en fin de fichier (verrou exclusif seulement)
+* @return vrai si le fichier se termine par une victoire complète
+*/
+bool rattraper_scores(t_scores *scores, bool reparer)
+{
+    unsigned char octets[SCORES_TAILLE_VICTOIRE * VICTOIRES_PAR_LECTURE];
+    t_victoire victoire;
+    struct stat infos;
+    off_t taille = fstat(scores->fichier, &infos) == 0 ? infos.st_size :
+        scores->lu;
+    off_t complet = taille -
+        (taille - SCORES_TAILLE_ENTETE) % SCORES_TAILLE_VICTOIRE;
+    ssize_t nbLus = 1;
+
+    // Fin incomplète : un jeu s'est arrêté pendant son écriture
+    if(reparer && complet < taille &&
+        ftruncate(scores->fichier, complet) == 0){
+        taille = complet;
+    }
+
+    while(nbLus > 0 && scores->lu < complet){
+        nbLus = pread(scores->fichier, octets, complet - scores->lu <
+            (off_t)sizeof(octets) ? complet - scores->lu : sizeof(octets),
+            scores->lu);
+        nbLus = nbLus > 0 ? nbLus - nbLus % SCORES_TAILLE_VICTOIRE : 0;
+        for(int i = 0 ; i < nbLus ; i += SCORES_TAILLE_VICTOIRE){
+            decoder_victoire(&octets[i], &victoire);
+            ranger_victoire(scores, &victoire);
+        }
+        scores->lu += nbLus;
+    }
+
+    return scores->lu == taille;
+}
+
+/**
+*
+* @brief Charger les statistiques et ouvrir le journal en ajout (il est
+*   créé s'il n'existe pas)
+* @param fichier de type chaîne de caractères, Entrée : journal
+* @param scores de type t_scores, Sortie : statistiques (vides et en
+*   mémoire seulement si le fichier n'est pas un journal ou ne peut pas
+*   être ouvert)
+* @return vrai si le fichier est utilisé
+*/
+bool ouvrir_scores(char fichier[], t_scores *scores)
+{
+    unsigned char entete[SCORES_TAILLE_ENTETE] = SCORES_SIGNATURE;
+    unsigned char lu[SCORES_TAILLE_ENTETE];
+    struct stat infos;
+    bool valide = false;
+
+    memset(scores, 0, sizeof(t_scores));
+    scores->capacite = NIVEAUX_INITIAUX;
+    scores->niveaux = malloc(sizeof(t_statsNiveau) * scores->capacite);
+    scores->tailleTable = NIVEAUX_INITIAUX * 2;
+    scores->table = calloc(scores->tailleTable, sizeof(long));
+    scores->fichier = open(fichier, O_RDWR | O_CREAT | O_APPEND, 0644);
+    entete[4] = SCORES_VERSION;
+
+    if(scores->fichier >= 0 && flock(scores->fichier, LOCK_EX) == 0){
+        // Fichier neuf, ou arrêté avant la fin de son en-tête
+        if(fstat(scores->fichier, &infos) == 0 &&
+            infos.st_size < SCORES_TAILLE_ENTETE &&
+            ftruncate(scores->fichier, 0) == 0){
+            valide = write(scores->fichier, entete, SCORES_TAILLE_ENTETE) ==
+                SCORES_TAILLE_ENTETE;
+        }
+        else{
+            valide = pread(scores->fichier, lu, SCORES_TAILLE_ENTETE, 0) ==
+                SCORES_TAILLE_ENTETE &&
+                memcmp(lu, entete, SCORES_TAILLE_ENTETE) == 0;
+        }
+        scores->lu = SCORES_TAILLE_ENTETE;
+        valide = valide && rattraper_scores(scores, true);
+        flock(scores->fichier, LOCK_UN);
+    }
+
+    if(!valide && scores->fichier >= 0){
+        close(scores->fichier);
+        scores->fichier = -1;
+    }
+
+    return scores->fichier >= 0;
+}
+
+/**
+*
+* @brief Fermer le journal et libérer les statistiques
+* @param scores de type t_scores, Entrée/Sortie : statistiques à fermer
+*/
+void fermer_scores(t_scores *scores)
+{
+    if(scores->fichier >= 0){
+        close(scores->fichier);
+    }
+    free(scores->niveaux);
+    free(scores->table);
+    memset(scores, 0, sizeof(t_scores));
+    scores->fichier = -1;
+}
+
+/**
+*
+* @brief Enregistrer une victoire : ajoutée au journal et rangée dans les
+*   statistiques (même si le journal ne peut pas être écrit)
+* @param scores de type t_scores, Entrée/Sortie : statistiques
+* @param victoire de type t_victoire, Entrée : victoire
+* @return vrai si la victoire est écrite dans le journal
+*/
+bool enregistrer_victoire(t_scores *scores, t_victoire *victoire)
+{
+    unsigned char octets[SCORES_TAILLE_VICTOIRE];
+    bool ecrite = false;
+
+    coder_victoire(victoire, octets);
+
+    if(scores->fichier >= 0 && flock(scores->fichier, LOCK_EX) == 0){
+        // Les victoires des autres jeux sont rangées avant la nôtre
+        if(rattraper_scores(scores, true)){
+            ecrite = write(scores->fichier, octets, SCORES_TAILLE_VICTOIRE)
+                == SCORES_TAILLE_VICTOIRE;
+        }
+        scores->lu += ecrite ? SCORES_TAILLE_VICTOIRE : 0;
+        flock(scores->fichier, LOCK_UN);
+    }
+    ranger_victoire(scores, victoire);
+
+    return ecrite;
+}
+
+/**
+*
+* @brief Consulter les statistiques d'un niveau, victoires des autres
+*   jeux comprises
+* @param scores de type t_scores, Entrée/Sortie : statistiques
+* @param empreinte de type entier 64 bits, Entrée : empreinte du niveau
+*   (voir empreinte_niveau)
+* @return pointeur : statistiques du niveau (valables jusqu'à la
+*   prochaine victoire rangée), NULL s'il n'a jamais été gagné
+*/
+t_statsNiveau *consulter_scores(t_scores *scores, uint64_t empreinte)
+{
+    t_statsNiveau *stats = NULL;
+    long place;
+
+    if(scores->fichier >= 0 && flock(scores->fichier, LOCK_SH) == 0){
+        rattraper_scores(scores, false);
+        flock(scores->fichier, LOCK_UN);
+    }
+
+    place = place_niveau(scores, empreinte);
+    if(scores->table[place] != 0){
+        stats = &scores->niveaux[scores->table[place] - 1];
+    }
+
+    return stats;
+}
@@ -0,0 +1,84 @@
+/**
+* @file scores.h
+* @brief Statistiques par niveau et classement des meilleures parties
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Chaque victoire est ajoutée à la fin d'un journal, jamais réécrit. À
+* l'ouverture, le journal est relu dans une table en mémoire : une entrée
+* par niveau, retrouvée par l'empreinte de sa forme canonique (voir
+* canonique.h). Un même niveau copié, tourné ou retourné partage donc ses
+* statistiques, quel que soit le nom de son fichier.
+*
+* Plusieurs jeux peuvent écrire en même temps : chaque victoire est écrite
+* d'un seul write sous un verrou exclusif du fichier (flock), et les
+* victoires des autres processus sont relues (à partir de la dernière
+* lue) avant chaque écriture et chaque consultation. Un enregistrement
+* incomplet en fin de fichier (arrêt pendant l'écriture) est retiré.
+*
+* Format : "SKSR", version, 3 octets nuls, puis des victoires de
+* SCORES_TAILLE_VICTOIRE octets (entiers en petit-boutiste) : empreinte
+* (8), joueur (TAILLE_JOUEUR, complété par des '\0'), déplacements (4),
+* poussées (4), durée en ms (4), tentatives (4), date en secondes (8).
+*/
+
+#ifndef SCORES_H
+#define SCORES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "sokoban.h"
+
+#define SCORES_VERSION          1
+#define SCORES_TAILLE_ENTETE    8
+#define SCORES_TAILLE_VICTOIRE  48
+#define FICHIER_SCORES          "bin/scores.db"
+#define TAILLE_JOUEUR           16   // nom du joueur, '\0' compris
+#define SCORES_CLASSEMENT       5    // meilleures parties gardées par niveau
+
+// Une victoire
+typedef struct {
+    uint64_t empreinte; // forme canonique du niveau (voir empreinte_niveau)
+    char joueur[TAILLE_JOUEUR];
+    int nbDeplacements;
+    int nbPoussees;
+    long duree; // en ms, depuis le dernier départ du niveau
+    int tentatives;
+    long date; // secondes depuis le 01/01/1970
+} t_victoire;
+
+// Statistiques d'un niveau : chaque record est le meilleur de toutes les
+// victoires, le classement garde les meilleures parties entières
+typedef struct {
+    uint64_t empreinte;
+    int nbVictoires;
+    int meilleursDeplacements;
+    int meilleuresPoussees;
+    long meilleureDuree;
+    int moinsTentatives;
+    int nbClasses;
+    // Déplacements, puis poussées, puis durée ; à égalité, la plus ancienne
+    t_victoire classement[SCORES_CLASSEMENT];
+} t_statsNiveau;
+
+// Statistiques de tous les niveaux
+typedef struct {
+    int fichier; // ouvert en ajout, -1 : statistiques en mémoire seulement
+    off_t lu; // octets du fichier déjà rangés dans la table
+    t_statsNiveau *niveaux;
+    long nbNiveaux;
+    long capacite;
+    long *table; // indice du niveau + 1, 0 si la place est libre
+    long tailleTable;
+} t_scores;
+
+uint64_t empreinte_niveau(t_plateau plateau);
+bool ouvrir_scores(char fichier[], t_scores *scores);
+void fermer_scores(t_scores *scores);
+bool enregistrer_victoire(t_scores *scores, t_victoire *victoire);
+t_statsNiveau *consulter_scores(t_scores *scores, uint64_t empreinte);
+
+#endif
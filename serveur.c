@@ -0,0 +1,749 @@
+/**
+* @file serveur.c
+* @brief Serveur de parties : de nombreux joueurs dans un seul processus
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Une session n'est jamais traitée par deux threads à la fois (EPOLLONESHOT,
+* réarmée à la fin du traitement) : seuls la liste des sessions ouvertes et
+* les compteurs sont protégés par le verrou du serveur.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "touches.h"
+#include "serveur.h"
+
+/* Écran du client (lignes à partir de 1) */
+
+#define LIGNE_PLATEAU   4
+#define LIGNE_STATUT    (LIGNE_PLATEAU + TAILLE + 1)
+#define LIGNE_MESSAGE   (LIGNE_STATUT + 2)
+
+#define EFFACER_ECRAN   "\033[2J\033[H"
+
+/* Fonctions internes */
+
+int preparer_ecoute(char socketUnix[], int port);
+void *boucle_serveur(void *argument);
+void accepter_sessions(t_serveur *serveur);
+void ouvrir_session(t_serveur *serveur, int client);
+void armer_session(t_serveur *serveur, t_session *session, int operation);
+void fermer_session(t_serveur *serveur, t_session *session);
+void servir_session(t_serveur *serveur, t_session *session,
+    unsigned int evenements);
+void lire_session(t_session *session);
+void saisir_niveau(t_session *session, char octet);
+void choisir_niveau(t_session *session);
+void demander_niveau(t_session *session);
+bool niveau_ferme(t_plateau plateau, int ligne, int colonne);
+void jouer_touche(t_session *session, char touche);
+void rendre_partie(t_session *session);
+void ajouter_sortie(t_session *session, const char format[], ...);
+void compacter_sortie(t_session *session);
+void envoyer_sortie(t_session *session);
+
+/**
+*
+* @brief Créer le socket d'écoute, non bloquant
+* @param socketUnix de type chaîne de caractères, Entrée : chemin du socket
+*   Unix (NULL : TCP)
+* @param port de type entier, Entrée : port TCP sur 127.0.0.1
+* @return entier : socket, -1 en cas d'échec
+*/
+int preparer_ecoute(char socketUnix[], int port)
+{
+    struct sockaddr_un adresseUnix;
+    struct sockaddr_in adresseTcp;
+    int reutiliser = 1;
+    int ecoute = socket(socketUnix != NULL ? AF_UNIX : AF_INET,
+        SOCK_STREAM, 0);
+    bool pret = ecoute >= 0;
+
+    if(pret && socketUnix != NULL){
+        memset(&adresseUnix, 0, sizeof(adresseUnix));
+        adresseUnix.sun_family = AF_UNIX;
+        strncpy(adresseUnix.sun_path, socketUnix,
+            sizeof(adresseUnix.sun_path) - 1);
+        // Socket laissé par un serveur arrêté brutalement
+        unlink(socketUnix);
+        pret = bind(ecoute, (struct sockaddr *)&adresseUnix,
+            sizeof(adresseUnix)) == 0;
+    }
+    else if(pret){
+        memset(&adresseTcp, 0, sizeof(adresseTcp));
+        adresseTcp.sin_family = AF_INET;
+        adresseTcp.sin_port = htons(port);
+        adresseTcp.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        setsockopt(ecoute, SOL_SOCKET, SO_REUSEADDR, &reutiliser,
+            sizeof(reutiliser));
+        pret = bind(ecoute, (struct sockaddr *)&adresseTcp,
+            sizeof(adresseTcp)) == 0;
+    }
+
+    pret = pret && listen(ecoute, SOMAXCONN) == 0 &&
+        fcntl(ecoute, F_SETFL, fcntl(ecoute, F_GETFL) | O_NONBLOCK) == 0;
+    if(!pret && ecoute >= 0){
+        close(ecoute);
+        ecoute = -1;
+    }
+
+    return ecoute;
+}
+
+/**
+*
+* @brief Ouvrir le serveur (socket d'écoute et ensemble epoll)
+* @param serveur de type t_serveur, Sortie : serveur
+* @param socketUnix de type chaîne de caractères, Entrée : chemin du socket
+*   Unix (NULL : TCP)
+* @param port de type entier, Entrée : port TCP sur 127.0.0.1
+* @param robots de type booléen, Entrée : vrai pour le protocole binaire
+*   des robots (voir robot.h)
+* @return vrai si le serveur écoute
+*/
+bool ouvrir_serveur(t_serveur *serveur, char socketUnix[], int port,
+    bool robots)
+{
+    struct epoll_event evenement;
+
+    memset(serveur, 0, sizeof(t_serveur));
+    serveur->robots = robots;
+    pthread_mutex_init(&serveur->verrou, NULL);
+    serveur->epoll = -1;
+    serveur->ecoute = preparer_ecoute(socketUnix, port);
+    if(serveur->ecoute >= 0 && socketUnix != NULL){
+        strncpy(serveur->chemin, socketUnix, TAILLE_CHEMIN - 1);
+    }
+
+    if(serveur->ecoute >= 0){
+        serveur->epoll = epoll_create1(0);
+        // Le socket d'écoute se reconnaît à son pointeur nul
+        evenement.events = EPOLLIN;
+        evenement.data.ptr = NULL;
+        if(serveur->epoll >= 0 && epoll_ctl(serveur->epoll, EPOLL_CTL_ADD,
+            serveur->ecoute, &evenement) != 0){
+            close(serveur->epoll);
+            serveur->epoll = -1;
+        }
+    }
+
+    return serveur->epoll >= 0;
+}
+
+/**
+*
+* @brief Servir les sessions jusqu'à l'arrêt
+* @param serveur de type t_serveur, Entrée/Sortie : serveur ouvert
+* @param nbThreads de type entier, Entrée : threads qui se partagent les
+*   événements (THREADS_SERVEUR_MAX au plus)
+* @param arret de type entier, Entrée : passe à 1 pour arrêter (depuis un
+*   gestionnaire de signal)
+*/
+void servir(t_serveur *serveur, int nbThreads, volatile sig_atomic_t *arret)
+{
+    pthread_t threads[THREADS_SERVEUR_MAX];
+    int nbLances = 0;
+
+    serveur->arret = arret;
+    while(nbLances < nbThreads && nbLances < THREADS_SERVEUR_MAX &&
+        pthread_create(&threads[nbLances], NULL, boucle_serveur,
+            serveur) == 0){
+        nbLances++;
+    }
+
+    for(int i = 0 ; i < nbLances ; i++){
+        pthread_join(threads[i], NULL);
+    }
+}
+
+/**
+*
+* @brief Fermer les sessions restantes puis le serveur
+* @param serveur de type t_serveur, Entrée/Sortie : serveur arrêté
+*/
+void fermer_serveur(t_serveur *serveur)
+{
+    while(serveur->sessions != NULL){
+        fermer_session(serveur, serveur->sessions);
+    }
+    if(serveur->epoll >= 0){
+        close(serveur->epoll);
+    }
+    if(serveur->ecoute >= 0){
+        close(serveur->ecoute);
+    }
+    if(serveur->chemin[0] != '\0'){
+        unlink(serveur->chemin);
+    }
+    pthread_mutex_destroy(&serveur->verrou);
+}
+
+/**
+*
+* @brief Traiter les événements jusqu'à l'arrêt (un thread du serveur)
+* @param argument de type t_serveur, Entrée/Sortie : serveur
+* @return NULL
+*/
+void *boucle_serveur(void *argument)
+{
+    t_serveur *serveur = argument;
+    struct epoll_event evenements[EVENEMENTS_MAX];
+    int nbEvenements;
+
+    while(!*serveur->arret){
+        nbEvenements = epoll_wait(serveur->epoll, evenements,
+            EVENEMENTS_MAX, ATTENTE_MS);
+        for(int i = 0 ; i < nbEvenements ; i++){
+            if(evenements[i].data.ptr == NULL){
+                accepter_sessions(serveur);
+            }
+            else{
+                servir_session(serveur, evenements[i].data.ptr,
+                    evenements[i].events);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+*
+* @brief Accepter toutes les connexions en attente
+* @param serveur de type t_serveur, Entrée/Sortie : serveur
+* Plusieurs threads peuvent être réveillés pour la même connexion : ceux
+* qui arrivent trop tard ne trouvent rien à accepter
+*/
+void accepter_sessions(t_serveur *serveur)
+{
+    int client = accept(serveur->ecoute, NULL, NULL);
+
+    while(client >= 0){
+        if(fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK)
+            == 0){
+            ouvrir_session(serveur, client);
+        }
+        else{
+            close(client);
+        }
+        client = accept(serveur->ecoute, NULL, NULL);
+    }
+}
+
+/**
+*
+* @brief Créer la session d'un client, lui demander un niveau (sauf
+*   robot) et la surveiller
+* @param serveur de type t_serveur, Entrée/Sortie : serveur
+* @param client de type entier, Entrée : socket du client (non bloquant)
+*/
+void ouvrir_session(t_serveur *serveur, int client)
+{
+    t_session *session = calloc(1, sizeof(t_session));
+
+    if(session == NULL){
+        close(client);
+    }
+    else{
+        session->socket = client;
+        session->etat = serveur->robots ? SESSION_ROBOT : SESSION_NIVEAU;
+        if(!serveur->robots){
+            ajouter_sortie(session, "SOKOBAN - serveur de parties\r\n\r\n");
+            demander_niveau(session);
+            envoyer_sortie(session);
+        }
+
+        pthread_mutex_lock(&serveur->verrou);
+        session->suivante = serveur->sessions;
+        if(serveur->sessions != NULL){
+            serveur->sessions->precedente = session;
+        }
+        serveur->sessions = session;
+        serveur->nbSessions++;
+        serveur->nbConnexions++;
+        pthread_mutex_unlock(&serveur->verrou);
+
+        armer_session(serveur, session, EPOLL_CTL_ADD);
+    }
+}
+
+/**
+*
+* @brief (Ré)armer la surveillance d'une session pour un seul événement
+* @param serveur de type t_serveur, Entrée : serveur
+* @param session de type t_session, Entrée : session
+* @param operation de type entier, Entrée : EPOLL_CTL_ADD ou EPOLL_CTL_MOD
+*/
+void armer_session(t_serveur *serveur, t_session *session, int operation)
+{
+    struct epoll_event evenement;
+
+    evenement.events = EPOLLRDHUP | EPOLLONESHOT;
+    // Un robot qui ne lit pas ses réponses n'envoie plus de requêtes
+    if(session->etat != SESSION_ROBOT ||
+        place_sortie(session) >= ROBOT_REPONSE_MAX){
+        evenement.events |= EPOLLIN;
+    }
+    // Le client ne lit pas assez vite : attendre de pouvoir écrire
+    if(session->debutSortie < session->finSortie){
+        evenement.events |= EPOLLOUT;
+    }
+    evenement.data.ptr = session;
+
+    epoll_ctl(serveur->epoll, operation, session->socket, &evenement);
+}
+
+/**
+*
+* @brief Fermer une session et la libérer
+* @param serveur de type t_serveur, Entrée/Sortie : serveur
+* @param session de type t_session, Entrée/Sortie : session à fermer
+*/
+void fermer_session(t_serveur *serveur, t_session *session)
+{
+    epoll_ctl(serveur->epoll, EPOLL_CTL_DEL, session->socket, NULL);
+    close(session->socket);
+
+    pthread_mutex_lock(&serveur->verrou);
+    if(session->precedente != NULL){
+        session->precedente->suivante = session->suivante;
+    }
+    else{
+        serveur->sessions = session->suivante;
+    }
+    if(session->suivante != NULL){
+        session->suivante->precedente = session->precedente;
+    }
+    serveur->nbSessions--;
+    pthread_mutex_unlock(&serveur->verrou);
+
+    free(session);
+}
+
+/**
+*
+* @brief Traiter un événement d'une session : jouer les touches reçues,
+*   envoyer l'image, puis réarmer ou fermer la session
+* @param serveur de type t_serveur, Entrée/Sortie : serveur
+* @param session de type t_session, Entrée/Sortie : session
+* @param evenements de type entier, Entrée : événements epoll
+*/
+void servir_session(t_serveur *serveur, t_session *session,
+    unsigned int evenements)
+{
+    if(session->etat == SESSION_ROBOT){
+        // Envoyer d'abord : les réponses en attente libèrent de la place
+        envoyer_sortie(session);
+        lire_robot(session);
+    }
+    else if(evenements & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)){
+        lire_session(session);
+    }
+    if(session->etat == SESSION_PARTIE){
+        rendre_partie(session);
+    }
+    envoyer_sortie(session);
+
+    if(session->fermer){
+        fermer_session(serveur, session);
+    }
+    else{
+        armer_session(serveur, session, EPOLL_CTL_MOD);
+    }
+}
+
+/**
+*
+* @brief Lire tout ce que le client a envoyé et le traiter
+* @param session de type t_session, Entrée/Sortie : session
+*/
+void lire_session(t_session *session)
+{
+    char tampon[TAILLE_LECTURE];
+    ssize_t nbLus = recv(session->socket, tampon, sizeof(tampon), 0);
+
+    while(nbLus > 0){
+        for(int i = 0 ; i < nbLus && !session->fermer ; i++){
+            if(session->etat == SESSION_NIVEAU){
+                saisir_niveau(session, tampon[i]);
+            }
+            else{
+                jouer_touche(session, tampon[i]);
+            }
+        }
+        nbLus = recv(session->socket, tampon, sizeof(tampon), 0);
+    }
+
+    // 0 : le client s'est déconnecté
+    if(nbLus == 0 || (errno != EAGAIN && errno != EWOULDBLOCK &&
+        errno != EINTR)){
+        session->fermer = true;
+    }
+}
+
+/**
+*
+* @brief Ajouter un caractère au nom du niveau demandé (retour à la
+*   ligne : valider, retour arrière : effacer)
+* @param session de type t_session, Entrée/Sortie : session
+* @param octet de type caractère, Entrée : caractère reçu
+* La saisie est renvoyée au client, dont le terminal est en mode brut
+*/
+void saisir_niveau(t_session *session, char octet)
+{
+    if(octet == '\r' || octet == '\n'){
+        // Une ligne vide (\r\n d'un terminal) est ignorée
+        if(session->longueurSaisie > 0){
+            session->saisie[session->longueurSaisie] = '\0';
+            session->longueurSaisie = 0;
+            ajouter_sortie(session, "\r\n");
+            choisir_niveau(session);
+        }
+    }
+    else if((octet == '\b' || octet == 127) && session->longueurSaisie > 0){
+        session->longueurSaisie--;
+        ajouter_sortie(session, "\b \b");
+    }
+    else if(isgraph((unsigned char)octet) &&
+        session->longueurSaisie < TAILLE_NOM_NIVEAU - 1){
+        session->saisie[session->longueurSaisie++] = octet;
+        ajouter_sortie(session, "%c", octet);
+    }
+}
+
+/**
+*
+* @brief Commencer le niveau saisi (ou quitter sur "e")
+* @param session de type t_session, Entrée/Sortie : session
+*/
+void choisir_niveau(t_session *session)
+{
+    if(strcmp(session->saisie, "e") == 0){
+        ajouter_sortie(session, "Sortie du jeu...\r\n");
+        session->fermer = true;
+    }
+    else if(charger_niveau_session(session, session->saisie)){
+        session->etat = SESSION_PARTIE;
+        session->tentatives = 1;
+        session->ecranComplet = true;
+    }
+    else{
+        ajouter_sortie(session, "Niveau introuvable : %s\r\n",
+            session->saisie);
+        demander_niveau(session);
+    }
+}
+
+/**
+*
+* @brief Charger un niveau pris dans DOSSIER_NIVEAUX (l'extension .sok
+*   peut être omise)
+* @param session de type t_session, Entrée/Sortie : session
+* @param nom de type chaîne de caractères, Entrée : nom du niveau
+* @return vrai si le niveau existe, contient un joueur et que sa zone est
+*   fermée par des murs
+*/
+bool charger_niveau_session(t_session *session, const char nom[])
+{
+    int longueur = strlen(nom);
+    bool extension = longueur > 4 && strcmp(&nom[longueur - 4], ".sok") == 0;
+    // Le client ne choisit que parmi les niveaux du dossier
+    bool valide = longueur > 0 && strchr(nom, '/') == NULL && nom[0] != '.';
+
+    snprintf(session->niveau, TAILLE_CHEMIN, "%s%s%s", DOSSIER_NIVEAUX,
+        nom, extension ? "" : ".sok");
+    // charger_partie arrête le programme si le fichier n'existe pas
+    valide = valide && access(session->niveau, R_OK) == 0;
+    if(valide){
+        session->moteur.joueur.posX = -1;
+        charger_niveau(&session->moteur, session->niveau);
+        memcpy(session->depart, session->moteur.plateau, sizeof(t_plateau));
+        valide = session->moteur.joueur.posX >= 0 &&
+            niveau_ferme(session->depart, session->moteur.joueur.posX,
+            session->moteur.joueur.posY);
+    }
+    if(!valide){
+        session->niveau[0] = '\0';
+    }
+
+    return valide;
+}
+
+/**
+*
+* @brief Vérifier que le joueur ne peut pas atteindre le bord du plateau
+*   (en traversant les caisses, qui peuvent être poussées)
+* @param plateau de type t_plateau, Entrée : niveau
+* @param ligne de type entier, Entrée : ligne du joueur
+* @param colonne de type entier, Entrée : colonne du joueur
+* @return vrai si la zone du joueur est fermée par des murs
+*/
+bool niveau_ferme(t_plateau plateau, int ligne, int colonne)
+{
+    const int DEP_LIGNE[4] = {-1, 1, 0, 0};
+    const int DEP_COLONNE[4] = {0, 0, -1, 1};
+    bool vue[TAILLE][TAILLE] = {{false}};
+    int pile[TAILLE * TAILLE];
+    int nbPile = 0;
+    bool ferme = true;
+    int voisineX, voisineY;
+
+    vue[ligne][colonne] = true;
+    pile[nbPile++] = ligne * TAILLE + colonne;
+    while(ferme && nbPile > 0){
+        ligne = pile[--nbPile] / TAILLE;
+        colonne = pile[nbPile] % TAILLE;
+        ferme = ligne > 0 && ligne < TAILLE - 1 && colonne > 0 &&
+            colonne < TAILLE - 1;
+        for(int dir = 0 ; ferme && dir < 4 ; dir++){
+            voisineX = ligne + DEP_LIGNE[dir];
+            voisineY = colonne + DEP_COLONNE[dir];
+            if(!vue[voisineX][voisineY] &&
+                plateau[voisineX][voisineY] != MUR){
+                vue[voisineX][voisineY] = true;
+                pile[nbPile++] = voisineX * TAILLE + voisineY;
+            }
+        }
+    }
+
+    return ferme;
+}
+
+/**
+*
+* @brief Demander le nom d'un niveau
+* @param session de type t_session, Entrée/Sortie : session
+*/
+void demander_niveau(t_session *session)
+{
+    session->etat = SESSION_NIVEAU;
+    session->longueurSaisie = 0;
+    ajouter_sortie(session, "Entrez le nom du niveau (dossier %s, ou \"e\" "
+        "pour fermer) : ", DOSSIER_NIVEAUX);
+}
+
+/**
+*
+* @brief Jouer une touche (mêmes touches que le jeu, voir touches.h)
+* @param session de type t_session, Entrée/Sortie : session en partie
+* @param touche de type caractère, Entrée : touche reçue
+*/
+void jouer_touche(t_session *session, char touche)
+{
+    t_moteur *moteur = &session->moteur;
+
+    switch(touche){
+        case MOVE_UP:
+            deplacer(moteur, -1, 0);
+            break;
+        case MOVE_LEFT:
+            deplacer(moteur, 0, -1);
+            break;
+        case MOVE_DOWN:
+            deplacer(moteur, 1, 0);
+            break;
+        case MOVE_RIGHT:
+            deplacer(moteur, 0, 1);
+            break;
+        case UNDO:
+            retour_arriere(moteur);
+            break;
+        case PUSH_THROUGH:
+            traverser_couloir(moteur);
+            break;
+        case RESTART:
+            memcpy(moteur->plateau, session->depart, sizeof(t_plateau));
+            demarrer_niveau(moteur);
+            session->tentatives++;
+            break;
+        case GIVE_UP:
+            ajouter_sortie(session, EFFACER_ECRAN "Vous avez abandonné :/"
+                "\r\n\r\n");
+            demander_niveau(session);
+            break;
+    }
+
+    if(session->etat == SESSION_PARTIE && gagne(moteur)){
+        rendre_partie(session);
+        ajouter_sortie(session, "\033[%d;1HVous avez gagné ! Il vous a fallu "
+            "%d déplacements et %d tentative(s).\r\n\r\n", LIGNE_MESSAGE,
+            moteur->deplacements.nbDeplacements, session->tentatives);
+        demander_niveau(session);
+    }
+}
+
+/**
+*
+* @brief Écrire l'image de la partie : seulement les cases et le compteur
+*   qui ont changé depuis la précédente
+* @param session de type t_session, Entrée/Sortie : session en partie
+*/
+void rendre_partie(t_session *session)
+{
+    t_moteur *moteur = &session->moteur;
+    bool change = session->ecranComplet;
+    int curseur = -1; // case où le curseur du client se trouve
+
+    if(session->ecranComplet){
+        ajouter_sortie(session, EFFACER_ECRAN "SOKOBAN - %s\r\n%c %c %c %c : "
+            "bouger | %c : annuler | %c : pousser jusqu'au bout | "
+            "%c : recommencer | %c : abandonner", session->niveau, MOVE_UP,
+            MOVE_LEFT, MOVE_DOWN, MOVE_RIGHT, UNDO, PUSH_THROUGH, RESTART,
+            GIVE_UP);
+        memset(session->affiche, '\0', sizeof(t_plateau));
+        session->deplacementsAffiches = -1;
+        session->ecranComplet = false;
+    }
+
+    for(int numCase = 0 ; numCase < TAILLE * TAILLE ; numCase++){
+        char contenu = moteur->plateau[numCase / TAILLE][numCase % TAILLE];
+        char *affiche = &session->affiche[numCase / TAILLE][numCase % TAILLE];
+
+        if(contenu != *affiche){
+            // Cases voisines sur une ligne : pas besoin de déplacer le
+            // curseur
+            if(curseur != numCase || numCase % TAILLE == 0){
+                ajouter_sortie(session, "\033[%d;%dH", LIGNE_PLATEAU +
+                    numCase / TAILLE, numCase % TAILLE + 1);
+            }
+            ajouter_sortie(session, "%c", contenu);
+            *affiche = contenu;
+            curseur = numCase + 1;
+            change = true;
+        }
+    }
+
+    if(moteur->deplacements.nbDeplacements != session->deplacementsAffiches){
+        session->deplacementsAffiches = moteur->deplacements.nbDeplacements;
+        ajouter_sortie(session, "\033[%d;1HDéplacements : %d\033[K",
+            LIGNE_STATUT, session->deplacementsAffiches);
+        change = true;
+    }
+    if(change){
+        ajouter_sortie(session, "\033[%d;1H", LIGNE_MESSAGE);
+    }
+}
+
+/**
+*
+* @brief Ajouter du texte à envoyer (la session est fermée si le client a
+*   trop de retard)
+* @param session de type t_session, Entrée/Sortie : session
+* @param format de type chaîne de caractères, Entrée : format de printf
+*/
+void ajouter_sortie(t_session *session, const char format[], ...)
+{
+    va_list arguments;
+    int longueur;
+    int place;
+
+    compacter_sortie(session);
+    place = TAILLE_SORTIE - session->finSortie;
+    va_start(arguments, format);
+    longueur = vsnprintf(&session->sortie[session->finSortie], place, format,
+        arguments);
+    va_end(arguments);
+
+    if(longueur >= place){
+        session->finSortie = TAILLE_SORTIE - 1;
+        session->fermer = true;
+    }
+    else{
+        session->finSortie += longueur;
+    }
+}
+
+/**
+*
+* @brief Ramener au début du tampon les octets pas encore envoyés
+* @param session de type t_session, Entrée/Sortie : session
+*/
+void compacter_sortie(t_session *session)
+{
+    if(session->debutSortie > 0){
+        memmove(session->sortie, &session->sortie[session->debutSortie],
+            session->finSortie - session->debutSortie);
+        session->finSortie -= session->debutSortie;
+        session->debutSortie = 0;
+    }
+}
+
+/**
+*
+* @brief Place libre pour la sortie, une fois le tampon compacté
+* @param session de type t_session, Entrée : session
+* @return entier : nombre d'octets
+*/
+int place_sortie(t_session *session)
+{
+    return TAILLE_SORTIE - (session->finSortie - session->debutSortie);
+}
+
+/**
+*
+* @brief Réserver des octets à la fin de la sortie
+* @param session de type t_session, Entrée/Sortie : session
+* @param taille de type entier, Entrée : nombre d'octets à écrire
+* @return pointeur sur les octets réservés, NULL si la place manque
+*/
+unsigned char *reserver_sortie(t_session *session, int taille)
+{
+    unsigned char *reserve = NULL;
+
+    compacter_sortie(session);
+    if(session->finSortie + taille <= TAILLE_SORTIE){
+        reserve = (unsigned char *)&session->sortie[session->finSortie];
+        session->finSortie += taille;
+    }
+
+    return reserve;
+}
+
+/**
+*
+* @brief Envoyer ce que le socket accepte sans attendre
+* @param session de type t_session, Entrée/Sortie : session
+*/
+void envoyer_sortie(t_session *session)
+{
+    ssize_t nbEnvoyes;
+    bool continuer = session->debutSortie < session->finSortie;
+
+    while(continuer){
+        nbEnvoyes = send(session->socket,
+            &session->sortie[session->debutSortie],
+            session->finSortie - session->debutSortie, MSG_NOSIGNAL);
+        if(nbEnvoyes > 0){
+            session->debutSortie += nbEnvoyes;
+        }
+        else if(errno != EINTR){
+            session->fermer = session->fermer ||
+                (errno != EAGAIN && errno != EWOULDBLOCK);
+            continuer = false;
+        }
+        continuer = continuer && session->debutSortie < session->finSortie;
+    }
+
+    if(session->debutSortie == session->finSortie){
+        session->debutSortie = 0;
+        session->finSortie = 0;
+    }
+}
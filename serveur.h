@@ -0,0 +1,102 @@
+/**
+* @file serveur.h
+* @brief Serveur de parties : de nombreux joueurs dans un seul processus
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le serveur écoute sur un socket Unix ou TCP (127.0.0.1 seulement). Chaque
+* connexion est une session avec sa propre partie (voir moteur.h). Tous les
+* sockets sont non bloquants et surveillés par un seul ensemble epoll, que
+* se partagent quelques threads : une session est armée en EPOLLONESHOT,
+* un seul thread à la fois la traite, sans verrou.
+*
+* Le client envoie le nom d'un niveau du dossier DOSSIER_NIVEAUX (suivi
+* d'un retour à la ligne), puis les touches du jeu (voir touches.h) :
+* déplacements, annulation, poussée jusqu'au bout du couloir, redémarrage
+* (sans confirmation) et abandon. Toutes les touches reçues d'un coup sont
+* jouées avant de répondre, et seules les cases qui ont changé depuis la
+* dernière image sont envoyées (codes de positionnement du terminal).
+*
+* Avec l'option robots, les sessions parlent le protocole binaire de
+* robot.h : pas d'affichage, des lots de coups et leurs résultats.
+*/
+
+#ifndef SERVEUR_H
+#define SERVEUR_H
+
+#include <stdbool.h>
+#include <signal.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "moteur.h"
+#include "robot.h"
+
+#define FICHIER_SOCKET      "bin/sokoban.sock"
+#define DOSSIER_NIVEAUX     "levels/"
+#define THREADS_SERVEUR_MAX 16
+#define EVENEMENTS_MAX      64      // événements lus par epoll_wait
+#define ATTENTE_MS          200     // délai avant de relire l'arrêt
+#define TAILLE_LECTURE      512
+#define TAILLE_SORTIE       8192    // au-delà, le client ne lit plus
+#define TAILLE_NOM_NIVEAU   64
+#define TAILLE_CHEMIN       108     // taille de sun_path
+
+// Ce qu'attend une session
+typedef enum {
+    SESSION_NIVEAU,     // le nom d'un niveau
+    SESSION_PARTIE,     // les touches du jeu
+    SESSION_ROBOT       // des requêtes binaires (voir robot.h)
+} t_etatSession;
+
+// Connexion d'un joueur
+typedef struct s_session {
+    int socket;
+    t_etatSession etat;
+    char saisie[TAILLE_NOM_NIVEAU];
+    int longueurSaisie;
+    char niveau[TAILLE_CHEMIN]; // fichier du niveau en cours
+    t_plateau depart; // plateau du niveau, pour recommencer sans le relire
+    t_moteur moteur;
+    int tentatives;
+    t_plateau affiche; // plateau tel que le client le voit
+    int deplacementsAffiches;
+    bool ecranComplet; // tout redessiner à la prochaine image
+    unsigned char entree[ROBOT_REQUETE_MAX]; // requête reçue en partie
+    int finEntree;
+    char sortie[TAILLE_SORTIE]; // octets pas encore envoyés
+    int debutSortie;
+    int finSortie;
+    bool fermer;
+    struct s_session *precedente; // sessions ouvertes (voir t_serveur)
+    struct s_session *suivante;
+} t_session;
+
+// Serveur en cours d'exécution
+typedef struct {
+    int ecoute;
+    int epoll;
+    char chemin[TAILLE_CHEMIN]; // socket Unix à supprimer, vide si TCP
+    bool robots; // protocole binaire au lieu du terminal
+    volatile sig_atomic_t *arret; // passe à 1 pour arrêter les threads
+    pthread_mutex_t verrou; // protège la liste et les compteurs
+    t_session *sessions;
+    long nbSessions; // ouvertes
+    long nbConnexions; // depuis le lancement
+} t_serveur;
+
+bool ouvrir_serveur(t_serveur *serveur, char socketUnix[], int port,
+    bool robots);
+void servir(t_serveur *serveur, int nbThreads,
+    volatile sig_atomic_t *arret);
+void fermer_serveur(t_serveur *serveur);
+
+/* Fonctions partagées par serveur.c et robot.c */
+
+bool charger_niveau_session(t_session *session, const char nom[]);
+unsigned char *reserver_sortie(t_session *session, int taille);
+int place_sortie(t_session *session);
+void lire_robot(t_session *session);
+
+#endif
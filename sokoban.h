@@ -0,0 +1,51 @@
+/**
+* @file sokoban.h
+* @brief Définitions communes au jeu et aux outils (solveur, ...)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Taille du plateau, caractères des fichiers .sok et codes des fichiers
+* de déplacements (.dep)
+*/
+
+#ifndef SOKOBAN_H
+#define SOKOBAN_H
+
+#define TAILLE 12
+
+#define MAX_DEP     999
+
+/* Définition des caractères */
+
+static const char PLAYER           = '@';
+static const char MUR              = '#';
+static const char CAISSE           = '$';
+static const char CIBLE            = '.';
+static const char PLAYER_SUR_CIBLE = '+';
+static const char CAISSE_SUR_CIBLE = '*';
+static const char VIDE             = ' ';
+
+/* Définition des variables de stockage */
+
+#define DEP_SOK_GAU        'g'
+#define DEP_SOK_HAU        'h'
+#define DEP_SOK_BAS        'b'
+#define DEP_SOK_DRO        'd'
+#define DEP_SOK_CAI_G      'G'
+#define DEP_SOK_CAI_H      'H'
+#define DEP_SOK_CAI_B      'B'
+#define DEP_SOK_CAI_D      'D'
+
+/* Définition du tableau */
+
+typedef char t_plateau[TAILLE][TAILLE];
+typedef char t_tabDeplacement[MAX_DEP];
+
+/* Fonctions fournies (fichiers.c) */
+
+void charger_partie(t_plateau plateau, char fichier[]);
+void enregistrer_partie(t_plateau plateau, char fichier[]);
+void enregistrer_deplacements(t_tabDeplacement t, int nb, char fic[]);
+
+#endif
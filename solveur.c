@@ -0,0 +1,1299 @@
+/**
+* @file solveur.c
+* @brief Solveur de niveaux par poussées de caisses
+* @author Liam CHARPENTIER
+* @version 2
+* @date 19/10/2026
+*
+* Recherche A* sur les poussées : l'heuristique étant une borne inférieure
+* qui varie d'au plus 1 par poussée, la première solution trouvée utilise
+* le moins de poussées possible. Deux états qui ne diffèrent que par la
+* position du joueur dans une même zone sont confondus.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#include "solveur.h"
+#include "heuristique.h"
+#include "macros.h"
+#include "bidirectionnel.h"
+#include "cache.h"
+
+#define NOEUDS_INITIAUX     65536
+
+// Entrée de la file de priorité de l'A*
+typedef struct {
+    int priorite; // poussées faites + poussées restantes estimées
+    int poussees;
+    long indice;
+} t_entreeTas;
+
+// File de priorité (tas binaire)
+typedef struct {
+    t_entreeTas *entrees;
+    long nbEntrees;
+    long capacite;
+} t_tas;
+
+/* Directions : haut, bas, gauche, droite (direction opposée : dir ^ 1) */
+
+const int DIR_LIGNE[NB_DIRECTIONS]      = {-1, 1, 0, 0};
+const int DIR_COLONNE[NB_DIRECTIONS]    = {0, 0, -1, 1};
+const char DIR_DEPLACEMENT[NB_DIRECTIONS] = {
+    DEP_SOK_HAU, DEP_SOK_BAS, DEP_SOK_GAU, DEP_SOK_DRO
+};
+const char DIR_POUSSEE[NB_DIRECTIONS] = {
+    DEP_SOK_CAI_H, DEP_SOK_CAI_B, DEP_SOK_CAI_G, DEP_SOK_CAI_D
+};
+
+/* Fonctions internes */
+
+uint64_t hacher_etat(t_etat *etat);
+void agrandir_table(t_recherche *recherche);
+long place_etat(t_recherche *recherche, t_etat *etat);
+bool entree_prioritaire(t_entreeTas *entreeA, t_entreeTas *entreeB);
+void ajouter_tas(t_tas *tas, t_recherche *recherche, long indice);
+t_entreeTas retirer_tas(t_tas *tas);
+void creer_enfant(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, t_poussee macro[], int nbMacro, bool rangee,
+    t_optionsSolveur *options);
+void pousser_caisse(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, int caisse, int direction, t_optionsSolveur *options);
+void developper_noeud(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, t_optionsSolveur *options);
+bool delai_depasse(struct timespec *debut, long delaiMs);
+long chercher_solution(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long *meilleur);
+int chemin_joueur(t_niveau *niveau, t_caisses *caisses, int depart,
+    int arrivee, char solution[], int longueur);
+int jouer_poussee(t_niveau *niveau, t_caisses *caisses, int *joueur,
+    t_poussee poussee, char solution[], int longueur);
+int lister_poussees(t_niveau *niveau, t_recherche *recherche, long indice,
+    bool macros, t_poussee poussees[], int nbMax);
+int reconstruire_solution(t_niveau *niveau, t_recherche *recherche,
+    long indiceFinal, bool macros, char solution[]);
+int resoudre_par_recherche(t_niveau *niveau, t_optionsSolveur *options,
+    char solution[], t_statsSolveur *stats);
+void memoriser_solution(t_niveau *niveau, t_recherche *recherche,
+    long indice, t_optionsSolveur *options);
+
+/**
+*
+* @brief Savoir si une case contient une caisse
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param numCase de type entier, Entrée : numéro de la case
+* @return vrai si la case contient une caisse
+*/
+bool case_occupee(t_caisses *caisses, int numCase)
+{
+    return (caisses->mots[numCase / 64] >> (numCase % 64)) & 1;
+}
+
+/**
+*
+* @brief Ajouter une caisse sur une case
+* @param caisses de type t_caisses, Entrée/Sortie : ensemble des caisses
+* @param numCase de type entier, Entrée : numéro de la case
+*/
+void ajouter_case(t_caisses *caisses, int numCase)
+{
+    caisses->mots[numCase / 64] |= (uint64_t)1 << (numCase % 64);
+}
+
+/**
+*
+* @brief Retirer la caisse d'une case
+* @param caisses de type t_caisses, Entrée/Sortie : ensemble des caisses
+* @param numCase de type entier, Entrée : numéro de la case
+*/
+void retirer_case(t_caisses *caisses, int numCase)
+{
+    caisses->mots[numCase / 64] &= ~((uint64_t)1 << (numCase % 64));
+}
+
+/**
+*
+* @brief Savoir si le joueur (ou une caisse) peut aller sur une case
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param numCase de type entier, Entrée : numéro de la case (-1 : dehors)
+* @return vrai si la case existe et n'est ni un mur ni une caisse
+*/
+bool case_libre(t_niveau *niveau, t_caisses *caisses, int numCase)
+{
+    return numCase >= 0 && !niveau->mur[numCase] &&
+        !case_occupee(caisses, numCase);
+}
+
+/**
+*
+* @brief Savoir si toutes les cibles sont couvertes par une caisse
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @return vrai si le niveau est résolu
+*/
+bool est_resolu(t_niveau *niveau, t_caisses *caisses)
+{
+    bool resolu = true;
+
+    for(int i = 0 ; i < MOTS_CAISSES ; i++){
+        if((niveau->cibles.mots[i] & ~caisses->mots[i]) != 0){
+            resolu = false;
+        }
+    }
+
+    return resolu;
+}
+
+/**
+*
+* @brief Calculer la zone atteignable par le joueur
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param depart de type entier, Entrée : case du joueur
+* @param atteint de type tableau de booléens, Sortie : cases atteignables
+* @return entier : case atteignable la plus en haut à gauche
+*/
+int zone_joueur(t_niveau *niveau, t_caisses *caisses, int depart,
+    bool atteint[])
+{
+    int pile[NB_CASES];
+    int nbPile = 0;
+    int minimum = depart;
+    int numCase, suivante;
+
+    memset(atteint, false, NB_CASES * sizeof(bool));
+    atteint[depart] = true;
+    pile[nbPile++] = depart;
+
+    while(nbPile > 0){
+        numCase = pile[--nbPile];
+        if(numCase < minimum){
+            minimum = numCase;
+        }
+
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            suivante = niveau->voisin[numCase][dir];
+            if(case_libre(niveau, caisses, suivante) && !atteint[suivante]){
+                atteint[suivante] = true;
+                pile[nbPile++] = suivante;
+            }
+        }
+    }
+
+    return minimum;
+}
+
+/**
+*
+* @brief Analyser un plateau : murs, voisins, cibles, caisses et joueur
+* @param plateau de type t_plateau, Entrée : plateau à analyser
+* @param niveau de type t_niveau, Sortie : niveau analysé
+* @return vrai si le niveau a un joueur, assez de caisses et au plus
+*   CIBLES_MAX caisses
+*/
+bool analyser_niveau(t_plateau plateau, t_niveau *niveau)
+{
+    bool atteint[NB_CASES];
+    int ligneVoisine, colonneVoisine;
+    char contenu;
+
+    memset(niveau, 0, sizeof(t_niveau));
+    niveau->joueurDepart = -1;
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        contenu = plateau[numCase / TAILLE][numCase % TAILLE];
+        niveau->mur[numCase] = contenu == MUR;
+
+        if((contenu == CIBLE || contenu == PLAYER_SUR_CIBLE ||
+            contenu == CAISSE_SUR_CIBLE) && niveau->nbCibles < CIBLES_MAX){
+            ajouter_case(&niveau->cibles, numCase);
+            niveau->caseCible[niveau->nbCibles++] = numCase;
+        }
+        if(contenu == CAISSE || contenu == CAISSE_SUR_CIBLE){
+            ajouter_case(&niveau->depart.caisses, numCase);
+            niveau->nbCaisses++;
+        }
+        if(contenu == PLAYER || contenu == PLAYER_SUR_CIBLE){
+            niveau->joueurDepart = numCase;
+        }
+
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            ligneVoisine = numCase / TAILLE + DIR_LIGNE[dir];
+            colonneVoisine = numCase % TAILLE + DIR_COLONNE[dir];
+            niveau->voisin[numCase][dir] = (ligneVoisine >= 0 &&
+                ligneVoisine < TAILLE && colonneVoisine >= 0 &&
+                colonneVoisine < TAILLE) ?
+                ligneVoisine * TAILLE + colonneVoisine : -1;
+        }
+    }
+
+    calculer_distances(niveau);
+    analyser_macros(niveau);
+
+    if(niveau->joueurDepart >= 0){
+        niveau->depart.joueur = zone_joueur(niveau, &niveau->depart.caisses,
+            niveau->joueurDepart, atteint);
+    }
+
+    return niveau->joueurDepart >= 0 &&
+        niveau->nbCaisses >= niveau->nbCibles &&
+        niveau->nbCaisses <= CIBLES_MAX;
+}
+
+/**
+*
+* @brief Calculer l'empreinte d'un état pour la table de hachage
+* @param etat de type t_etat, Entrée : état à hacher
+* @return entier 64 bits : empreinte
+*/
+uint64_t hacher_etat(t_etat *etat)
+{
+    uint64_t hache = (etat->joueur + 1) * 0x9E3779B97F4A7C15ULL;
+
+    for(int i = 0 ; i < MOTS_CAISSES ; i++){
+        hache ^= etat->caisses.mots[i] + 0x9E3779B97F4A7C15ULL +
+            (hache << 6) + (hache >> 2);
+    }
+
+    hache ^= hache >> 33;
+    hache *= 0xFF51AFD7ED558CCDULL;
+    hache ^= hache >> 33;
+
+    return hache;
+}
+
+/**
+*
+* @brief Comparer deux états
+* @param etatA de type t_etat, Entrée : premier état
+* @param etatB de type t_etat, Entrée : second état
+* @return vrai si les états sont identiques
+*/
+bool etats_egaux(t_etat *etatA, t_etat *etatB)
+{
+    bool egaux = etatA->joueur == etatB->joueur;
+
+    for(int i = 0 ; egaux && i < MOTS_CAISSES ; i++){
+        egaux = etatA->caisses.mots[i] == etatB->caisses.mots[i];
+    }
+
+    return egaux;
+}
+
+/**
+*
+* @brief Préparer une recherche vide
+* @param recherche de type t_recherche, Sortie : recherche à préparer
+* @param tailleDonnees de type entier, Entrée : entiers gardés par noeud
+*   pour l'heuristique (voir taille_donnees_heuristique)
+*/
+void initialiser_recherche(t_recherche *recherche, int tailleDonnees)
+{
+    recherche->capacite = NOEUDS_INITIAUX;
+    recherche->nbNoeuds = 0;
+    recherche->noeuds = malloc(sizeof(t_noeud) * recherche->capacite);
+    recherche->tailleTable = NOEUDS_INITIAUX * 2;
+    recherche->table = calloc(recherche->tailleTable, sizeof(long));
+    recherche->tailleDonnees = tailleDonnees;
+    recherche->donnees = malloc(sizeof(int) *
+        (recherche->capacite * tailleDonnees + 1));
+}
+
+/**
+*
+* @brief Libérer la mémoire d'une recherche
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+*/
+void liberer_recherche(t_recherche *recherche)
+{
+    free(recherche->noeuds);
+    free(recherche->table);
+    free(recherche->donnees);
+    recherche->noeuds = NULL;
+    recherche->table = NULL;
+    recherche->donnees = NULL;
+    recherche->nbNoeuds = 0;
+}
+
+/**
+*
+* @brief Doubler la taille de la table de hachage
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+*/
+void agrandir_table(t_recherche *recherche)
+{
+    long masque;
+    long position;
+
+    free(recherche->table);
+    recherche->tailleTable *= 2;
+    recherche->table = calloc(recherche->tailleTable, sizeof(long));
+    masque = recherche->tailleTable - 1;
+
+    for(long i = 0 ; i < recherche->nbNoeuds ; i++){
+        position = hacher_etat(&recherche->noeuds[i].etat) & masque;
+        while(recherche->table[position] != 0){
+            position = (position + 1) & masque;
+        }
+        recherche->table[position] = i + 1;
+    }
+}
+
+/**
+*
+* @brief Trouver la place d'un état dans la table de hachage
+* @param recherche de type t_recherche, Entrée : recherche
+* @param etat de type t_etat, Entrée : état cherché
+* @return entier long : place de l'état, ou place libre où l'ajouter
+*/
+long place_etat(t_recherche *recherche, t_etat *etat)
+{
+    long masque = recherche->tailleTable - 1;
+    long position = hacher_etat(etat) & masque;
+
+    while(recherche->table[position] != 0 && !etats_egaux(etat,
+        &recherche->noeuds[recherche->table[position] - 1].etat)){
+        position = (position + 1) & masque;
+    }
+
+    return position;
+}
+
+/**
+*
+* @brief Chercher un état déjà rencontré
+* @param recherche de type t_recherche, Entrée : recherche
+* @param etat de type t_etat, Entrée : état cherché
+* @return entier long : indice du noeud, -1 si l'état est nouveau
+*/
+long chercher_etat(t_recherche *recherche, t_etat *etat)
+{
+    return recherche->table[place_etat(recherche, etat)] - 1;
+}
+
+/**
+*
+* @brief Ajouter un état s'il n'a pas encore été rencontré
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param etat de type t_etat, Entrée : nouvel état
+* @param parent de type entier, Entrée : indice du noeud parent
+* @param caisse de type entier, Entrée : case de la caisse poussée
+* @param direction de type entier, Entrée : direction de la poussée
+* @return entier long : indice du nouveau noeud, -1 s'il existait déjà
+*/
+long ajouter_etat(t_recherche *recherche, t_etat *etat, int parent,
+    int caisse, int direction)
+{
+    long position;
+    long indice = -1;
+    t_noeud *noeud;
+
+    if((recherche->nbNoeuds + 1) * 2 > recherche->tailleTable){
+        agrandir_table(recherche);
+    }
+    if(recherche->nbNoeuds == recherche->capacite){
+        recherche->capacite *= 2;
+        recherche->noeuds = realloc(recherche->noeuds,
+            sizeof(t_noeud) * recherche->capacite);
+        recherche->donnees = realloc(recherche->donnees, sizeof(int) *
+            (recherche->capacite * recherche->tailleDonnees + 1));
+    }
+
+    position = place_etat(recherche, etat);
+    if(recherche->table[position] == 0){
+        indice = recherche->nbNoeuds++;
+        recherche->table[position] = indice + 1;
+
+        noeud = &recherche->noeuds[indice];
+        noeud->etat = *etat;
+        noeud->parent = parent;
+        noeud->caisse = caisse;
+        noeud->direction = direction;
+        noeud->poussees = 0;
+        noeud->estimation = 0;
+        noeud->rangee = false;
+        noeud->developpe = false;
+        noeud->arriere = false;
+    }
+
+    return indice;
+}
+
+/**
+*
+* @brief Savoir si une caisse peut être poussée dans une direction
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param caisse de type entier, Entrée : case à pousser (-1 : dehors)
+* @param direction de type entier, Entrée : direction de la poussée
+* @return vrai si la case contient une caisse qui peut avancer
+*/
+bool poussee_possible(t_niveau *niveau, t_caisses *caisses, int caisse,
+    int direction)
+{
+    int arrivee;
+    bool possible = false;
+
+    if(caisse >= 0 && case_occupee(caisses, caisse)){
+        arrivee = niveau->voisin[caisse][direction];
+        possible = case_libre(niveau, caisses, arrivee) &&
+            !niveau->caseMorte[arrivee];
+    }
+
+    return possible;
+}
+
+/**
+*
+* @brief Savoir si une caisse qui vient d'être poussée hors d'une cible ne
+*   pourra plus jamais bouger (d'après la base de motifs)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param motifs de type t_motifs, Entrée : base de motifs (NULL : aucune)
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param numCase de type entier, Entrée : case de la caisse
+* @return vrai si l'état est un interblocage
+*/
+bool caisse_figee(t_niveau *niveau, t_motifs *motifs, t_caisses *caisses,
+    int numCase)
+{
+    t_voisinage voisinage;
+    int ligne, colonne, voisine;
+    bool figee = false;
+
+    if(motifs != NULL && !case_occupee(&niveau->cibles, numCase)){
+        for(int i = 0 ; i < TAILLE_VOISINAGE ; i++){
+            for(int j = 0 ; j < TAILLE_VOISINAGE ; j++){
+                ligne = numCase / TAILLE + i - CENTRE_VOISINAGE;
+                colonne = numCase % TAILLE + j - CENTRE_VOISINAGE;
+                voisine = ligne * TAILLE + colonne;
+                voisinage[i][j] = (ligne < 0 || ligne >= TAILLE ||
+                    colonne < 0 || colonne >= TAILLE ||
+                    niveau->mur[voisine]) ? MOTIF_MUR :
+                    case_occupee(caisses, voisine) ? MOTIF_CAISSE : MOTIF_VIDE;
+            }
+        }
+        figee = motif_bloque(motifs, voisinage);
+    }
+
+    return figee;
+}
+
+/**
+*
+* @brief Savoir si une entrée du tas doit sortir avant une autre
+*   (priorité la plus faible, puis le plus de poussées déjà faites)
+* @param entreeA de type t_entreeTas, Entrée : première entrée
+* @param entreeB de type t_entreeTas, Entrée : seconde entrée
+* @return vrai si entreeA passe avant entreeB
+*/
+bool entree_prioritaire(t_entreeTas *entreeA, t_entreeTas *entreeB)
+{
+    return entreeA->priorite < entreeB->priorite ||
+        (entreeA->priorite == entreeB->priorite &&
+        entreeA->poussees > entreeB->poussees);
+}
+
+/**
+*
+* @brief Ajouter un noeud dans la file de priorité
+* @param tas de type t_tas, Entrée/Sortie : file de priorité
+* @param recherche de type t_recherche, Entrée : recherche
+* @param indice de type entier long, Entrée : noeud à ajouter
+*/
+void ajouter_tas(t_tas *tas, t_recherche *recherche, long indice)
+{
+    t_entreeTas entree;
+    long position = tas->nbEntrees++;
+
+    if(tas->nbEntrees > tas->capacite){
+        tas->capacite = tas->capacite * 2 + NOEUDS_INITIAUX;
+        tas->entrees = realloc(tas->entrees,
+            sizeof(t_entreeTas) * tas->capacite);
+    }
+
+    entree.poussees = recherche->noeuds[indice].poussees;
+    entree.priorite = entree.poussees + recherche->noeuds[indice].estimation;
+    entree.indice = indice;
+
+    while(position > 0 && entree_prioritaire(&entree,
+        &tas->entrees[(position - 1) / 2])){
+        tas->entrees[position] = tas->entrees[(position - 1) / 2];
+        position = (position - 1) / 2;
+    }
+    tas->entrees[position] = entree;
+}
+
+/**
+*
+* @brief Retirer l'entrée la plus prioritaire de la file (non vide)
+* @param tas de type t_tas, Entrée/Sortie : file de priorité
+* @return t_entreeTas : entrée retirée
+*/
+t_entreeTas retirer_tas(t_tas *tas)
+{
+    t_entreeTas premiere = tas->entrees[0];
+    t_entreeTas derniere = tas->entrees[--tas->nbEntrees];
+    long position = 0;
+    long enfant = 1;
+
+    while(enfant < tas->nbEntrees){
+        if(enfant + 1 < tas->nbEntrees && entree_prioritaire(
+            &tas->entrees[enfant + 1], &tas->entrees[enfant])){
+            enfant++;
+        }
+        if(entree_prioritaire(&tas->entrees[enfant], &derniere)){
+            tas->entrees[position] = tas->entrees[enfant];
+            position = enfant;
+            enfant = 2 * position + 1;
+        }
+        else{
+            enfant = tas->nbEntrees;
+        }
+    }
+    tas->entrees[position] = derniere;
+
+    return premiere;
+}
+
+/**
+*
+* @brief Créer (ou raccourcir) le noeud obtenu par une suite de poussées
+*   d'une même caisse
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param tas de type t_tas, Entrée/Sortie : noeuds à développer
+* @param indice de type entier long, Entrée : noeud de départ
+* @param macro de type tableau de t_poussee, Entrée : poussées à faire
+* @param nbMacro de type entier, Entrée : nombre de poussées
+* @param rangee de type booléen, Entrée : vrai si les dernières poussées
+*   rangent la caisse dans la salle des cibles (voir ranger_dans_salle)
+* @param options de type t_optionsSolveur, Entrée : réglages
+*/
+void creer_enfant(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, t_poussee macro[], int nbMacro, bool rangee,
+    t_optionsSolveur *options)
+{
+    bool atteint[NB_CASES];
+    int donnees[4 * CIBLES_MAX];
+    t_etat enfant = recherche->noeuds[indice].etat;
+    int caisse = macro[0].caisse;
+    int arrivee, joueur;
+    int poussees;
+    int taille = recherche->tailleDonnees;
+    int estimation;
+    long existant;
+
+    // La même caisse est poussée du début à la fin de la macro
+    joueur = macro[nbMacro - 1].caisse;
+    arrivee = niveau->voisin[joueur][macro[nbMacro - 1].direction];
+    poussees = recherche->noeuds[indice].poussees + nbMacro;
+
+    retirer_case(&enfant.caisses, caisse);
+    ajouter_case(&enfant.caisses, arrivee);
+    enfant.joueur = zone_joueur(niveau, &enfant.caisses, joueur, atteint);
+
+    existant = chercher_etat(recherche, &enfant);
+    if(existant >= 0 && !recherche->noeuds[existant].developpe &&
+        poussees < recherche->noeuds[existant].poussees){
+        // Chemin plus court vers un noeud pas encore développé
+        recherche->noeuds[existant].parent = indice;
+        recherche->noeuds[existant].caisse = caisse;
+        recherche->noeuds[existant].direction = macro[0].direction;
+        recherche->noeuds[existant].rangee = rangee;
+        recherche->noeuds[existant].poussees = poussees;
+        ajouter_tas(tas, recherche, existant);
+    }
+    else if(existant < 0){
+        estimation = estimer_poussee(niveau, options->heuristique,
+            &enfant.caisses, &recherche->donnees[indice * taille], caisse,
+            arrivee, donnees);
+
+        if(estimation < DISTANCE_INFINIE && !caisse_figee(niveau,
+            options->motifs, &enfant.caisses, arrivee)){
+            existant = ajouter_etat(recherche, &enfant, indice, caisse,
+                macro[0].direction);
+            memcpy(&recherche->donnees[existant * taille], donnees,
+                sizeof(int) * taille);
+            recherche->noeuds[existant].rangee = rangee;
+            recherche->noeuds[existant].poussees = poussees;
+            recherche->noeuds[existant].estimation = estimation;
+            ajouter_tas(tas, recherche, existant);
+        }
+    }
+}
+
+/**
+*
+* @brief Créer les noeuds obtenus en poussant une caisse : la poussée et
+*   celles qu'elle rend obligatoires, puis, si la caisse arrive à l'entrée
+*   de la salle des cibles, la même suite avec son rangement
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param tas de type t_tas, Entrée/Sortie : noeuds à développer
+* @param indice de type entier long, Entrée : noeud de départ
+* @param caisse de type entier, Entrée : case de la caisse poussée
+* @param direction de type entier, Entrée : direction de la poussée
+* @param options de type t_optionsSolveur, Entrée : réglages
+*/
+void pousser_caisse(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, int caisse, int direction, t_optionsSolveur *options)
+{
+    t_poussee macro[POUSSEES_MACRO_MAX];
+    t_caisses *caisses = &recherche->noeuds[indice].etat.caisses;
+    int nbMacro = 1;
+    int nbRangement;
+
+    macro[0].caisse = caisse;
+    macro[0].direction = direction;
+    if(options->macros){
+        nbMacro = etendre_poussee(niveau, caisses, caisse, direction, macro);
+    }
+    creer_enfant(niveau, recherche, tas, indice, macro, nbMacro, false,
+        options);
+
+    // Le rangement s'ajoute à la poussée seule au lieu de la remplacer :
+    // une position résoluble ne peut pas être perdue par l'ordre imposé
+    if(options->macros){
+        nbRangement = ranger_dans_salle(niveau, caisses, macro, nbMacro);
+        if(nbRangement > nbMacro){
+            creer_enfant(niveau, recherche, tas, indice, macro, nbRangement,
+                true, options);
+        }
+    }
+}
+
+/**
+*
+* @brief Créer tous les noeuds atteignables en une poussée
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param tas de type t_tas, Entrée/Sortie : noeuds à développer
+* @param indice de type entier long, Entrée : noeud à développer
+* @param options de type t_optionsSolveur, Entrée : réglages
+*/
+void developper_noeud(t_niveau *niveau, t_recherche *recherche, t_tas *tas,
+    long indice, t_optionsSolveur *options)
+{
+    bool atteint[NB_CASES];
+    t_etat etat = recherche->noeuds[indice].etat;
+    int caisse;
+
+    recherche->noeuds[indice].developpe = true;
+    zone_joueur(niveau, &etat.caisses, etat.joueur, atteint);
+
+    for(int numCase = 0 ; numCase < NB_CASES ; numCase++){
+        for(int dir = 0 ; atteint[numCase] && dir < NB_DIRECTIONS ; dir++){
+            caisse = niveau->voisin[numCase][dir];
+
+            if(poussee_possible(niveau, &etat.caisses, caisse, dir)){
+                pousser_caisse(niveau, recherche, tas, indice, caisse, dir,
+                    options);
+            }
+        }
+    }
+}
+
+/**
+*
+* @brief Savoir si le temps accordé à une recherche est écoulé
+* @param debut de type struct timespec, Entrée : début de la recherche
+* @param delaiMs de type entier long, Entrée : temps accordé en
+*   millisecondes (0 : illimité)
+* @return vrai si la recherche doit s'arrêter
+*/
+bool delai_depasse(struct timespec *debut, long delaiMs)
+{
+    struct timespec maintenant;
+
+    clock_gettime(CLOCK_MONOTONIC, &maintenant);
+
+    return delaiMs > 0 && (maintenant.tv_sec - debut->tv_sec) * 1000 +
+        (maintenant.tv_nsec - debut->tv_nsec) / 1000000 >= delaiMs;
+}
+
+/**
+*
+* @brief Développer les noeuds par ordre de priorité jusqu'à une solution
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée/Sortie : recherche
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param meilleur de type entier long, Sortie : noeud développé dont
+*   l'estimation est la plus faible (-1 si aucun), pour conseiller une
+*   poussée quand la recherche s'arrête avant la solution
+* @return entier long : noeud résolu, -1 si aucune solution n'est trouvée
+*/
+long chercher_solution(t_niveau *niveau, t_recherche *recherche,
+    t_optionsSolveur *options, long *meilleur)
+{
+    t_tas tas = {NULL, 0, 0};
+    t_entreeTas entree;
+    t_noeud *noeud;
+    struct timespec debut;
+    long resolu = -1;
+    long nbDeveloppes = 0;
+    bool arret = false;
+    int estimation;
+
+    clock_gettime(CLOCK_MONOTONIC, &debut);
+    *meilleur = -1;
+
+    estimation = estimer_depart(niveau, options->heuristique,
+        &niveau->depart.caisses, recherche->donnees);
+    if(estimation < DISTANCE_INFINIE){
+        ajouter_etat(recherche, &niveau->depart, -1, 0, 0);
+        recherche->noeuds[0].estimation = estimation;
+        ajouter_tas(&tas, recherche, 0);
+    }
+
+    while(resolu < 0 && !arret && tas.nbEntrees > 0 &&
+        recherche->nbNoeuds < options->limiteNoeuds){
+        entree = retirer_tas(&tas);
+        noeud = &recherche->noeuds[entree.indice];
+
+        // Les entrées d'un noeud déjà développé ou raccourci depuis sont
+        // périmées
+        if(!noeud->developpe && entree.poussees == noeud->poussees){
+            if(*meilleur < 0 || noeud->estimation <
+                recherche->noeuds[*meilleur].estimation){
+                *meilleur = entree.indice;
+            }
+            if(est_resolu(niveau, &noeud->etat.caisses)){
+                resolu = entree.indice;
+            }
+            else{
+                developper_noeud(niveau, recherche, &tas, entree.indice,
+                    options);
+            }
+            // L'horloge n'est lue que de temps en temps
+            arret = ++nbDeveloppes % 256 == 0 &&
+                (delai_depasse(&debut, options->delaiMs) ||
+                (options->interrompre != NULL &&
+                options->interrompre(options->contexte)));
+        }
+    }
+
+    free(tas.entrees);
+
+    return resolu;
+}
+
+/**
+*
+* @brief Écrire le plus court chemin du joueur entre deux cases
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée : ensemble des caisses
+* @param depart de type entier, Entrée : case du joueur
+* @param arrivee de type entier, Entrée : case à atteindre
+* @param solution de type chaîne de caractères, Entrée/Sortie : solution
+* @param longueur de type entier, Entrée : longueur actuelle de la solution
+* @return entier : nouvelle longueur, -1 si le chemin n'existe pas
+*/
+int chemin_joueur(t_niveau *niveau, t_caisses *caisses, int depart,
+    int arrivee, char solution[], int longueur)
+{
+    int versArrivee[NB_CASES];
+    int file[NB_CASES];
+    int debut = 0, fin = 0;
+    int numCase, suivante;
+
+    memset(versArrivee, -1, sizeof(versArrivee));
+    file[fin++] = arrivee;
+
+    // Parcours depuis l'arrivée : chaque case retient la direction à
+    // prendre pour s'en rapprocher
+    while(debut < fin && versArrivee[depart] < 0 && depart != arrivee){
+        numCase = file[debut++];
+        for(int dir = 0 ; dir < NB_DIRECTIONS ; dir++){
+            suivante = niveau->voisin[numCase][dir];
+            if(case_libre(niveau, caisses, suivante) &&
+                versArrivee[suivante] < 0 && suivante != arrivee){
+                versArrivee[suivante] = dir ^ 1;
+                file[fin++] = suivante;
+            }
+        }
+    }
+
+    numCase = depart;
+    while(longueur >= 0 && numCase != arrivee){
+        if(versArrivee[numCase] < 0 || longueur >= TAILLE_SOLUTION_MAX - 2){
+            longueur = -1;
+        }
+        else{
+            solution[longueur++] = DIR_DEPLACEMENT[versArrivee[numCase]];
+            numCase = niveau->voisin[numCase][versArrivee[numCase]];
+        }
+    }
+
+    return longueur;
+}
+
+/**
+*
+* @brief Amener le joueur derrière une caisse puis la pousser, en écrivant
+*   les déplacements
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param caisses de type t_caisses, Entrée/Sortie : ensemble des caisses
+* @param joueur de type entier, Entrée/Sortie : case du joueur
+* @param poussee de type t_poussee, Entrée : poussée à faire
+* @param solution de type chaîne de caractères, Entrée/Sortie : solution
+* @param longueur de type entier, Entrée : longueur actuelle de la solution
+* @return entier : nouvelle longueur, -1 si la poussée est impossible
+*/
+int jouer_poussee(t_niveau *niveau, t_caisses *caisses, int *joueur,
+    t_poussee poussee, char solution[], int longueur)
+{
+    longueur = chemin_joueur(niveau, caisses, *joueur,
+        niveau->voisin[poussee.caisse][poussee.direction ^ 1],
+        solution, longueur);
+
+    if(longueur >= 0){
+        solution[longueur++] = DIR_POUSSEE[poussee.direction];
+        retirer_case(caisses, poussee.caisse);
+        ajouter_case(caisses,
+            niveau->voisin[poussee.caisse][poussee.direction]);
+        *joueur = poussee.caisse;
+    }
+
+    return longueur;
+}
+
+/**
+*
+* @brief Écrire la solution complète (déplacements g/h/b/d et poussées
+*   G/H/B/D) d'une suite de poussées depuis le départ
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param poussees de type tableau de t_poussee, Entrée : poussées
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @param solution de type chaîne de caractères, Sortie : solution
+* @return entier : longueur de la solution, -1 si elle est trop longue
+*/
+int ecrire_poussees(t_niveau *niveau, t_poussee poussees[], int nbPoussees,
+    char solution[])
+{
+    t_caisses caisses = niveau->depart.caisses;
+    int joueur = niveau->joueurDepart;
+    int longueur = 0;
+
+    for(int i = 0 ; longueur >= 0 && i < nbPoussees ; i++){
+        longueur = jouer_poussee(niveau, &caisses, &joueur, poussees[i],
+            solution, longueur);
+    }
+
+    solution[longueur >= 0 ? longueur : 0] = '\0';
+
+    return longueur;
+}
+
+/**
+*
+* @brief Calculer l'état atteint après chaque poussée
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param poussees de type tableau de t_poussee, Entrée : poussées
+* @param nbPoussees de type entier, Entrée : nombre de poussées
+* @param etats de type tableau de t_etat, Sortie : état de départ puis
+*   état après chaque poussée (nbPoussees + 1 états)
+*/
+void calculer_etats(t_niveau *niveau, t_poussee poussees[], int nbPoussees,
+    t_etat etats[])
+{
+    bool atteint[NB_CASES];
+    t_poussee poussee;
+
+    etats[0] = niveau->depart;
+    for(int i = 0 ; i < nbPoussees ; i++){
+        poussee = poussees[i];
+        etats[i + 1] = etats[i];
+        retirer_case(&etats[i + 1].caisses, poussee.caisse);
+        ajouter_case(&etats[i + 1].caisses,
+            niveau->voisin[poussee.caisse][poussee.direction]);
+        etats[i + 1].joueur = zone_joueur(niveau, &etats[i + 1].caisses,
+            poussee.caisse, atteint);
+    }
+}
+
+/**
+*
+* @brief Trouver la direction d'un code de déplacement (poussée ou non)
+* @param deplacement de type caractère, Entrée : code g/h/b/d ou G/H/B/D
+* @return entier : direction, -1 si le code est inconnu
+*/
+int direction_deplacement(char deplacement)
+{
+    int direction;
+
+    switch(tolower(deplacement)){
+        case DEP_SOK_HAU:
+            direction = 0;
+            break;
+        case DEP_SOK_BAS:
+            direction = 1;
+            break;
+        case DEP_SOK_GAU:
+            direction = 2;
+            break;
+        case DEP_SOK_DRO:
+            direction = 3;
+            break;
+        default:
+            direction = -1;
+    }
+
+    return direction;
+}
+
+/**
+*
+* @brief Rejouer des déplacements depuis le départ et relever les poussées
+*   (les déplacements impossibles sont ignorés, comme dans le jeu)
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param deplacements de type chaîne de caractères, Entrée : déplacements
+* @param nbDeplacements de type entier, Entrée : nombre de déplacements
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+*   (nbDeplacements au plus)
+* @return entier : nombre de poussées
+*/
+int rejouer_deplacements(t_niveau *niveau, char deplacements[],
+    int nbDeplacements, t_poussee poussees[])
+{
+    t_caisses caisses = niveau->depart.caisses;
+    int joueur = niveau->joueurDepart;
+    int nbPoussees = 0;
+    int direction, suivante;
+
+    for(int i = 0 ; i < nbDeplacements ; i++){
+        direction = direction_deplacement(deplacements[i]);
+        suivante = direction < 0 ? -1 : niveau->voisin[joueur][direction];
+
+        if(suivante >= 0 && case_occupee(&caisses, suivante) &&
+            case_libre(niveau, &caisses, niveau->voisin[suivante][direction])){
+            poussees[nbPoussees].caisse = suivante;
+            poussees[nbPoussees++].direction = direction;
+            retirer_case(&caisses, suivante);
+            ajouter_case(&caisses, niveau->voisin[suivante][direction]);
+            joueur = suivante;
+        }
+        else if(case_libre(niveau, &caisses, suivante)){
+            joueur = suivante;
+        }
+    }
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Relever les poussées qui mènent du départ à un noeud
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée : recherche terminée
+* @param indice de type entier long, Entrée : noeud d'arrivée
+* @param macros de type booléen, Entrée : vrai si la recherche a enchaîné
+*   les poussées forcées (elles sont recalculées de la même façon)
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+* @param nbMax de type entier, Entrée : nombre maximal de poussées
+* @return entier : nombre de poussées (nbMax au plus)
+*/
+int lister_poussees(t_niveau *niveau, t_recherche *recherche, long indice,
+    bool macros, t_poussee poussees[], int nbMax)
+{
+    t_caisses caisses = niveau->depart.caisses;
+    t_poussee macro[POUSSEES_MACRO_MAX];
+    t_noeud *noeud;
+    long *noeuds;
+    int nbNoeuds = 0;
+    int nbMacro;
+    int nbPoussees = 0;
+
+    for(long i = indice ; recherche->noeuds[i].parent >= 0 ;
+        i = recherche->noeuds[i].parent){
+        nbNoeuds++;
+    }
+    noeuds = malloc(sizeof(long) * (nbNoeuds + 1));
+    for(long i = indice, j = nbNoeuds - 1 ; j >= 0 ; j--){
+        noeuds[j] = i;
+        i = recherche->noeuds[i].parent;
+    }
+
+    for(int i = 0 ; nbPoussees < nbMax && i < nbNoeuds ; i++){
+        noeud = &recherche->noeuds[noeuds[i]];
+        nbMacro = 1;
+        macro[0].caisse = noeud->caisse;
+        macro[0].direction = noeud->direction;
+        if(macros){
+            nbMacro = etendre_poussee(niveau, &caisses, noeud->caisse,
+                noeud->direction, macro);
+        }
+        if(noeud->rangee){
+            nbMacro = ranger_dans_salle(niveau, &caisses, macro, nbMacro);
+        }
+        retirer_case(&caisses, macro[0].caisse);
+        ajouter_case(&caisses, niveau->voisin[macro[nbMacro - 1].caisse]
+            [macro[nbMacro - 1].direction]);
+
+        for(int j = 0 ; nbPoussees < nbMax && j < nbMacro ; j++){
+            poussees[nbPoussees++] = macro[j];
+        }
+    }
+
+    free(noeuds);
+
+    return nbPoussees;
+}
+
+/**
+*
+* @brief Rejouer les poussées trouvées et écrire la solution complète
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée : recherche terminée
+* @param indiceFinal de type entier long, Entrée : noeud résolu
+* @param macros de type booléen, Entrée : vrai si la recherche a enchaîné
+*   les poussées forcées
+* @param solution de type chaîne de caractères, Sortie : solution
+* @return entier : longueur de la solution, -1 si elle est trop longue
+*/
+int reconstruire_solution(t_niveau *niveau, t_recherche *recherche,
+    long indiceFinal, bool macros, char solution[])
+{
+    t_poussee *poussees = malloc(sizeof(t_poussee) * TAILLE_SOLUTION_MAX);
+    int nbPoussees;
+    int longueur;
+
+    nbPoussees = lister_poussees(niveau, recherche, indiceFinal, macros,
+        poussees, TAILLE_SOLUTION_MAX);
+    longueur = ecrire_poussees(niveau, poussees, nbPoussees, solution);
+    free(poussees);
+
+    return longueur;
+}
+
+/**
+*
+* @brief Chercher la solution d'un niveau et l'écrire
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @param solution de type chaîne de caractères, Sortie : déplacements
+* @param stats de type t_statsSolveur, Sortie : noeuds explorés et créés
+* @return entier : longueur de la solution, -1 si elle n'est pas trouvée
+*/
+int resoudre_par_recherche(t_niveau *niveau, t_optionsSolveur *options,
+    char solution[], t_statsSolveur *stats)
+{
+    t_recherche recherche;
+    long resolu = -1;
+    long meilleur;
+    int longueur = -1;
+
+    initialiser_recherche(&recherche,
+        taille_donnees_heuristique(niveau, options->heuristique));
+    // Les positions résolues ne sont connues que si chaque caisse finit
+    // sur une cible
+    if(options->bidirectionnel && niveau->nbCaisses == niveau->nbCibles){
+        longueur = chercher_bidirectionnel(niveau, &recherche, options,
+            solution);
+    }
+    else{
+        resolu = chercher_solution(niveau, &recherche, options, &meilleur);
+    }
+
+    for(long i = 0 ; i < recherche.nbNoeuds ; i++){
+        stats->noeudsExplores += recherche.noeuds[i].developpe;
+    }
+    stats->noeudsCrees = recherche.nbNoeuds;
+    if(resolu >= 0){
+        longueur = reconstruire_solution(niveau, &recherche, resolu,
+            options->macros, solution);
+    }
+    liberer_recherche(&recherche);
+
+    return longueur;
+}
+
+/**
+*
+* @brief Retenir dans le cache la solution trouvée par une recherche
+* @param niveau de type t_niveau, Entrée : niveau analysé
+* @param recherche de type t_recherche, Entrée : recherche terminée
+* @param indice de type entier long, Entrée : noeud résolu
+* @param options de type t_optionsSolveur, Entrée : réglages (cache et
+*   macros)
+*/
+void memoriser_solution(t_niveau *niveau, t_recherche *recherche,
+    long indice, t_optionsSolveur *options)
+{
+    t_poussee *poussees = malloc(sizeof(t_poussee) * TAILLE_SOLUTION_MAX);
+    char *solution = malloc(TAILLE_SOLUTION_MAX);
+    long noeuds = 0;
+    int nbPoussees, longueur;
+
+    nbPoussees = lister_poussees(niveau, recherche, indice, options->macros,
+        poussees, TAILLE_SOLUTION_MAX);
+    longueur = ecrire_poussees(niveau, poussees, nbPoussees, solution);
+    for(long i = 0 ; i < recherche->nbNoeuds ; i++){
+        noeuds += recherche->noeuds[i].developpe;
+    }
+
+    if(longueur >= 0){
+        enrichir_cache(options->cache, niveau, poussees, nbPoussees,
+            longueur, noeuds);
+    }
+
+    free(poussees);
+    free(solution);
+}
+
+/**
+*
+* @brief Remplir les réglages par défaut du solveur
+* @param options de type t_optionsSolveur, Sortie : réglages
+*/
+void options_par_defaut(t_optionsSolveur *options)
+{
+    options->heuristique = HEURISTIQUE_AFFECTATION;
+    options->macros = true;
+    options->limiteNoeuds = LIMITE_NOEUDS;
+    options->motifs = NULL;
+    options->bidirectionnel = false;
+    options->delaiMs = 0;
+    options->interrompre = NULL;
+    options->contexte = NULL;
+    options->cache = NULL;
+}
+
+/**
+*
+* @brief Résoudre un niveau avec les réglages par défaut
+* @param plateau de type t_plateau, Entrée : plateau à résoudre
+* @param solution de type chaîne de caractères, Sortie : déplacements
+*   (TAILLE_SOLUTION_MAX caractères au plus)
+* @param stats de type t_statsSolveur, Sortie : statistiques
+* @param limiteNoeuds de type entier long, Entrée : nombre max de noeuds
+* @return vrai si une solution a été trouvée
+*/
+bool resoudre_niveau(t_plateau plateau, char solution[],
+    t_statsSolveur *stats, long limiteNoeuds)
+{
+    t_optionsSolveur options;
+
+    options_par_defaut(&options);
+    options.limiteNoeuds = limiteNoeuds;
+
+    return resoudre_niveau_options(plateau, solution, stats, &options);
+}
+
+/**
+*
+* @brief Résoudre un niveau avec des réglages donnés (pour comparer les
+*   heuristiques, les macros et les deux sens de recherche)
+* @param plateau de type t_plateau, Entrée : plateau à résoudre
+* @param solution de type chaîne de caractères, Sortie : déplacements
+*   (TAILLE_SOLUTION_MAX caractères au plus)
+* @param stats de type t_statsSolveur, Sortie : statistiques
+* @param options de type t_optionsSolveur, Entrée : réglages
+* @return vrai si une solution a été trouvée
+*/
+bool resoudre_niveau_options(t_plateau plateau, char solution[],
+    t_statsSolveur *stats, t_optionsSolveur *options)
+{
+    t_niveau niveau;
+    t_poussee *poussees = malloc(sizeof(t_poussee) * TAILLE_SOLUTION_MAX);
+    int nbPoussees = -1;
+    int longueur = -1;
+
+    memset(stats, 0, sizeof(t_statsSolveur));
+    solution[0] = '\0';
+
+    if(analyser_niveau(plateau, &niveau)){
+        if(options->cache != NULL){
+            nbPoussees = consulter_cache(options->cache, &niveau, poussees,
+                TAILLE_SOLUTION_MAX, stats);
+        }
+        longueur = nbPoussees >= 0 ?
+            ecrire_poussees(&niveau, poussees, nbPoussees, solution) :
+            resoudre_par_recherche(&niveau, options, solution, stats);
+        stats->trouve = longueur >= 0;
+        stats->nbDeplacements = longueur;
+    }
+
+    if(stats->trouve && options->cache != NULL && !stats->enCache){
+        nbPoussees = rejouer_deplacements(&niveau, solution, longueur,
+            poussees);
+        enrichir_cache(options->cache, &niveau, poussees, nbPoussees,
+            longueur, stats->noeudsExplores);
+    }
+    free(poussees);
+
+    for(int i = 0 ; stats->trouve && solution[i] != '\0' ; i++){
+        if(solution[i] >= 'A' && solution[i] <= 'Z'){
+            stats->nbPoussees++;
+        }
+    }
+
+    return stats->trouve;
+}
+
+/**
+*
+* @brief Chercher, en un temps limité, les poussées à faire depuis un
+*   plateau : jusqu'à la solution si elle est trouvée à temps, sinon
+*   jusqu'à l'état le plus proche d'une solution d'après l'heuristique
+* @param plateau de type t_plateau, Entrée : plateau de départ
+* @param options de type t_optionsSolveur, Entrée : réglages (délai
+*   compris ; la recherche bidirectionnelle est ignorée)
+* @param poussees de type tableau de t_poussee, Sortie : poussées
+* @param nbMax de type entier, Entrée : nombre maximal de poussées
+* @param verdict de type t_verdict, Sortie : VERDICT_RESOLU si les
+*   poussées résolvent le niveau, VERDICT_IMPOSSIBLE si tous les états
+*   atteignables ont été essayés sans solution
+* @return entier : nombre de poussées, -1 si le niveau est invalide ou
+*   s'il ne peut plus être résolu
+*/
+int planifier_poussees(t_plateau plateau, t_optionsSolveur *options,
+    t_poussee poussees[], int nbMax, t_verdict *verdict)
+{
+    t_niveau niveau;
+    t_recherche recherche;
+    long trouve, meilleur = -1;
+    int nbPoussees = -1;
+    bool epuisee = true;
+    bool analyse = analyser_niveau(plateau, &niveau);
+
+    *verdict = VERDICT_INCONNU;
+
+    if(analyse && options->cache != NULL){
+        nbPoussees = consulter_cache(options->cache, &niveau, poussees,
+            nbMax, NULL);
+        *verdict = nbPoussees >= 0 ? VERDICT_RESOLU : VERDICT_INCONNU;
+    }
+
+    if(analyse && nbPoussees < 0){
+        initialiser_recherche(&recherche,
+            taille_donnees_heuristique(&niveau, options->heuristique));
+        trouve = chercher_solution(&niveau, &recherche, options, &meilleur);
+
+        // Chaque noeud créé entre dans la file : si tous ont été
+        // développés, la recherche n'a pas été coupée
+        for(long i = 0 ; epuisee && i < recherche.nbNoeuds ; i++){
+            epuisee = recherche.noeuds[i].developpe;
+        }
+        *verdict = trouve >= 0 ? VERDICT_RESOLU :
+            epuisee ? VERDICT_IMPOSSIBLE : VERDICT_INCONNU;
+        if(trouve >= 0){
+            meilleur = trouve;
+        }
+        if(meilleur >= 0){
+            nbPoussees = lister_poussees(&niveau, &recherche, meilleur,
+                options->macros, poussees, nbMax);
+        }
+        if(trouve >= 0 && options->cache != NULL){
+            memoriser_solution(&niveau, &recherche, trouve, options);
+        }
+        liberer_recherche(&recherche);
+    }
+
+    return nbPoussees;
+}
@@ -0,0 +1,186 @@
+/**
+* @file solveur.h
+* @brief Solveur de niveaux par poussées de caisses
+* @author Liam CHARPENTIER
+* @version 3
+* @date 19/10/2026
+*
+* Les noeuds de la recherche sont des positions de caisses associées à la
+* zone atteignable par le joueur (représentée par sa case la plus en haut
+* à gauche). Chaque arc est une poussée, éventuellement suivie de celles
+* qu'elle rend obligatoires ou du rangement de la caisse (voir macros.h) :
+* les déplacements du joueur entre deux poussées sont recalculés une fois
+* la solution trouvée.
+* La recherche est un A* guidé par une borne inférieure du nombre de
+* poussées restantes (voir heuristique.h), ou une recherche en largeur
+* menée des deux bouts (voir bidirectionnel.h). Une position dont la
+* solution est déjà dans le cache (voir cache.h) est rendue sans recherche.
+*/
+
+#ifndef SOLVEUR_H
+#define SOLVEUR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "sokoban.h"
+#include "motifs.h"
+
+#define NB_CASES            (TAILLE * TAILLE)
+#define MOTS_CAISSES        ((NB_CASES + 63) / 64)
+#define NB_DIRECTIONS       4
+#define LIMITE_NOEUDS       2000000
+#define TAILLE_SOLUTION_MAX 10000
+#define CIBLES_MAX          64
+#define DISTANCE_INFINIE    1000 // caisse qui ne peut pas atteindre la cible
+
+// Ensemble de cases (un bit par case), utilisé pour les caisses
+typedef struct {
+    uint64_t mots[MOTS_CAISSES];
+} t_caisses;
+
+// Etat de la recherche
+typedef struct {
+    t_caisses caisses;
+    unsigned char joueur; // case atteignable la plus en haut à gauche
+} t_etat;
+
+// Partie fixe d'un niveau, calculée au chargement
+typedef struct {
+    bool mur[NB_CASES];
+    bool caseMorte[NB_CASES]; // une caisse ici n'atteint plus aucune cible
+    int voisin[NB_CASES][NB_DIRECTIONS]; // -1 si hors du plateau
+    t_caisses cibles;
+    int caseCible[CIBLES_MAX];
+    // nombre minimal de poussées pour amener une caisse sur chaque cible
+    // (en ignorant les autres caisses)
+    unsigned short distance[CIBLES_MAX][NB_CASES];
+    int nbCibles;
+    int nbCaisses;
+    int joueurDepart; // vraie case du joueur au départ
+    t_etat depart;
+    // case sans cible bordée de murs des deux côtés (couloir de largeur 1)
+    // selon chaque axe (0 : vertical, 1 : horizontal), voir macros.h
+    bool tunnel[NB_CASES][2];
+    // salle des cibles : zone reliée au reste par la seule case entreeSalle
+    // (-1 si le niveau n'en a pas) et ses cibles dans l'ordre de remplissage
+    bool salle[NB_CASES];
+    int entreeSalle;
+    int ordreSalle[CIBLES_MAX];
+    int nbCiblesSalle;
+} t_niveau;
+
+// Poussée d'une caisse d'une case dans une direction
+typedef struct {
+    int caisse; // case de la caisse avant la poussée
+    int direction;
+} t_poussee;
+
+// Noeud de la recherche : état + poussée qui y mène depuis le parent
+typedef struct {
+    t_etat etat;
+    int parent;
+    unsigned char caisse; // case de la caisse avant la poussée
+    unsigned char direction;
+    bool rangee; // la caisse est ensuite rangée dans la salle des cibles
+    unsigned short poussees; // poussées depuis le départ
+    unsigned short estimation; // poussées restantes au minimum
+    bool developpe;
+    bool arriere; // créé par la recherche arrière (voir bidirectionnel.h)
+} t_noeud;
+
+// Ensemble des états rencontrés (table de hachage sur les noeuds)
+typedef struct {
+    t_noeud *noeuds;
+    long nbNoeuds;
+    long capacite;
+    long *table; // indice du noeud + 1, 0 si la place est libre
+    long tailleTable;
+    int *donnees; // données de l'heuristique, tailleDonnees par noeud
+    int tailleDonnees;
+} t_recherche;
+
+// Heuristique utilisée par la recherche
+typedef enum {
+    HEURISTIQUE_AUCUNE,       // recherche en largeur
+    HEURISTIQUE_PROCHE,       // somme des distances à la cible la plus proche
+    HEURISTIQUE_AFFECTATION   // affectation caisses/cibles de coût minimal
+} t_heuristique;
+
+// Solutions déjà trouvées, gardées sur disque (voir cache.h)
+typedef struct s_cache t_cache;
+
+// Réglages d'une recherche
+typedef struct {
+    t_heuristique heuristique;
+    bool macros; // enchaîner les poussées forcées (voir macros.h)
+    long limiteNoeuds;
+    t_motifs *motifs; // interblocages précalculés, NULL si non chargés
+    // chercher aussi depuis les positions résolues (recherche en largeur,
+    // l'heuristique et les macros sont ignorées)
+    bool bidirectionnel;
+    long delaiMs; // temps accordé à la recherche, 0 : illimité
+    // appelée de temps en temps : la recherche s'arrête si elle rend vrai
+    // (NULL : jamais)
+    bool (*interrompre)(void *contexte);
+    void *contexte;
+    // solution connue rendue sans recherche, nouvelle solution retenue
+    // (NULL : aucun cache)
+    t_cache *cache;
+} t_optionsSolveur;
+
+// Résultat d'une recherche limitée (voir planifier_poussees)
+typedef enum {
+    VERDICT_INCONNU,      // recherche coupée avant la fin
+    VERDICT_RESOLU,
+    VERDICT_IMPOSSIBLE    // aucun état atteignable n'est résolu
+} t_verdict;
+
+// Statistiques d'une recherche
+typedef struct {
+    bool trouve;
+    long noeudsExplores;
+    long noeudsCrees;
+    int nbPoussees;
+    int nbDeplacements;
+    // solution lue dans le cache : noeudsExplores est alors celui de la
+    // recherche qui l'a trouvée
+    bool enCache;
+} t_statsSolveur;
+
+bool analyser_niveau(t_plateau plateau, t_niveau *niveau);
+int zone_joueur(t_niveau *niveau, t_caisses *caisses, int depart,
+    bool atteint[]);
+bool case_occupee(t_caisses *caisses, int numCase);
+bool case_libre(t_niveau *niveau, t_caisses *caisses, int numCase);
+void ajouter_case(t_caisses *caisses, int numCase);
+void retirer_case(t_caisses *caisses, int numCase);
+bool est_resolu(t_niveau *niveau, t_caisses *caisses);
+bool poussee_possible(t_niveau *niveau, t_caisses *caisses, int caisse,
+    int direction);
+bool caisse_figee(t_niveau *niveau, t_motifs *motifs, t_caisses *caisses,
+    int numCase);
+
+bool etats_egaux(t_etat *etatA, t_etat *etatB);
+void initialiser_recherche(t_recherche *recherche, int tailleDonnees);
+void liberer_recherche(t_recherche *recherche);
+long chercher_etat(t_recherche *recherche, t_etat *etat);
+long ajouter_etat(t_recherche *recherche, t_etat *etat, int parent,
+    int caisse, int direction);
+int ecrire_poussees(t_niveau *niveau, t_poussee poussees[], int nbPoussees,
+    char solution[]);
+void calculer_etats(t_niveau *niveau, t_poussee poussees[], int nbPoussees,
+    t_etat etats[]);
+int direction_deplacement(char deplacement);
+int rejouer_deplacements(t_niveau *niveau, char deplacements[],
+    int nbDeplacements, t_poussee poussees[]);
+
+bool resoudre_niveau(t_plateau plateau, char solution[],
+    t_statsSolveur *stats, long limiteNoeuds);
+void options_par_defaut(t_optionsSolveur *options);
+bool resoudre_niveau_options(t_plateau plateau, char solution[],
+    t_statsSolveur *stats, t_optionsSolveur *options);
+int planifier_poussees(t_plateau plateau, t_optionsSolveur *options,
+    t_poussee poussees[], int nbMax, t_verdict *verdict);
+
+#endif
@@ -0,0 +1,246 @@
+/**
+* @file surveillance.c
+* @brief Vérification en arrière-plan que la partie peut encore être gagnée
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le jeu et le thread ne partagent que la position demandée et le verdict,
+* sous le verrou ; la recherche se fait sur une copie du plateau.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "surveillance.h"
+
+/* Fonctions internes */
+
+bool position_depassee(void *contexte);
+void retenir_verdict(t_surveillance *surveillance, t_etat *etat,
+    t_verdict verdict);
+t_verdict verifier_position(t_surveillance *surveillance,
+    t_plateau plateau);
+void *surveiller(void *argument);
+
+/**
+*
+* @brief Savoir si la position en vérification est dépassée (appelée par
+*   la recherche, dans le thread)
+* @param contexte de type t_surveillance, Entrée : surveillance
+* @return vrai si le jeu a déposé une autre position ou s'arrête
+*/
+bool position_depassee(void *contexte)
+{
+    t_surveillance *surveillance = contexte;
+    bool depassee;
+
+    pthread_mutex_lock(&surveillance->verrou);
+    depassee = surveillance->arret ||
+        surveillance->demande != surveillance->enCours;
+    pthread_mutex_unlock(&surveillance->verrou);
+
+    return depassee;
+}
+
+/**
+*
+* @brief Garder le verdict d'un état (les plus anciens sont remplacés)
+* @param surveillance de type t_surveillance, Entrée/Sortie : surveillance
+* @param etat de type t_etat, Entrée : état vérifié
+* @param verdict de type t_verdict, Entrée : verdict de l'état
+*/
+void retenir_verdict(t_surveillance *surveillance, t_etat *etat,
+    t_verdict verdict)
+{
+    int place = surveillance->nbConnus % VERDICTS_GARDES;
+
+    surveillance->etatsConnus[place] = *etat;
+    surveillance->verdictsConnus[place] = verdict;
+    surveillance->nbConnus++;
+}
+
+/**
+*
+* @brief Chercher si une position peut encore être résolue
+* @param surveillance de type t_surveillance, Entrée/Sortie : surveillance
+* @param plateau de type t_plateau, Entrée : position à vérifier
+* @return t_verdict : VERDICT_INCONNU si la recherche a été coupée
+*/
+t_verdict verifier_position(t_surveillance *surveillance, t_plateau plateau)
+{
+    t_niveau niveau;
+    t_optionsSolveur options;
+    t_conseil *plan = &surveillance->plan;
+    t_verdict verdict = VERDICT_INCONNU;
+    int nbConnus = surveillance->nbConnus < VERDICTS_GARDES ?
+        surveillance->nbConnus : VERDICTS_GARDES;
+    int connu = -1;
+    bool analyse = analyser_niveau(plateau, &niveau);
+
+    for(int i = 0 ; analyse && connu < 0 && i < nbConnus ; i++){
+        if(etats_egaux(&surveillance->etatsConnus[i], &niveau.depart)){
+            connu = i;
+            verdict = surveillance->verdictsConnus[i];
+        }
+    }
+    if(analyse && connu < 0 && etape_plan(plan, &niveau.depart) >= 0){
+        connu = VERDICTS_GARDES;
+        verdict = VERDICT_RESOLU;
+    }
+
+    if(analyse && connu < 0){
+        options_par_defaut(&options);
+        options.limiteNoeuds = NOEUDS_SURVEILLANCE;
+        options.motifs = surveillance->motifs->bits != NULL ?
+            surveillance->motifs : NULL;
+        options.interrompre = position_depassee;
+        options.contexte = surveillance;
+        options.cache = surveillance->cache;
+
+        plan->nbPoussees = planifier_poussees(plateau, &options,
+            plan->poussees, PLAN_CONSEIL_MAX, &verdict);
+        plan->resolu = verdict == VERDICT_RESOLU;
+        if(!plan->resolu){
+            plan->nbPoussees = 0;
+        }
+        calculer_etats(&niveau, plan->poussees, plan->nbPoussees,
+            plan->etats);
+        if(verdict != VERDICT_INCONNU){
+            retenir_verdict(surveillance, &niveau.depart, verdict);
+        }
+    }
+
+    return verdict;
+}
+
+/**
+*
+* @brief Boucle du thread : attendre une position, la vérifier, publier le
+*   verdict
+* @param argument de type t_surveillance, Entrée/Sortie : surveillance
+* @return NULL
+*/
+void *surveiller(void *argument)
+{
+    t_surveillance *surveillance = argument;
+    t_plateau plateau;
+    t_verdict verdict;
+    bool continuer = true;
+
+    while(continuer){
+        pthread_mutex_lock(&surveillance->verrou);
+        while(!surveillance->arret &&
+            surveillance->demande == surveillance->traitee){
+            pthread_cond_wait(&surveillance->demandeArrivee,
+                &surveillance->verrou);
+        }
+        continuer = !surveillance->arret;
+        memcpy(plateau, surveillance->plateau, sizeof(t_plateau));
+        surveillance->enCours = surveillance->demande;
+        pthread_mutex_unlock(&surveillance->verrou);
+
+        if(continuer){
+            verdict = verifier_position(surveillance, plateau);
+
+            // Un verdict arrivé trop tard n'est pas publié
+            pthread_mutex_lock(&surveillance->verrou);
+            if(surveillance->enCours == surveillance->demande){
+                surveillance->verdict = verdict;
+            }
+            surveillance->traitee = surveillance->enCours;
+            pthread_mutex_unlock(&surveillance->verrou);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+*
+* @brief Lancer le thread de vérification
+* @param motifs de type t_motifs, Entrée : base de motifs (éventuellement
+*   vide), gardée pendant toute la surveillance
+* @param cache de type t_cache, Entrée/Sortie : solutions déjà trouvées
+*   (NULL : aucun cache), gardé pendant toute la surveillance
+* @return t_surveillance : surveillance à passer aux autres fonctions,
+*   NULL si le thread n'a pas pu être lancé
+*/
+t_surveillance *lancer_surveillance(t_motifs *motifs, t_cache *cache)
+{
+    t_surveillance *surveillance = calloc(1, sizeof(t_surveillance));
+
+    surveillance->motifs = motifs;
+    surveillance->cache = cache;
+    surveillance->verdict = VERDICT_INCONNU;
+    oublier_conseil(&surveillance->plan);
+    pthread_mutex_init(&surveillance->verrou, NULL);
+    pthread_cond_init(&surveillance->demandeArrivee, NULL);
+
+    if(pthread_create(&surveillance->thread, NULL, surveiller,
+        surveillance) != 0){
+        pthread_mutex_destroy(&surveillance->verrou);
+        pthread_cond_destroy(&surveillance->demandeArrivee);
+        free(surveillance);
+        surveillance = NULL;
+    }
+
+    return surveillance;
+}
+
+/**
+*
+* @brief Déposer une nouvelle position à vérifier (sans attendre)
+* @param surveillance de type t_surveillance, Entrée/Sortie : surveillance
+* @param plateau de type t_plateau, Entrée : position courante
+*/
+void surveiller_position(t_surveillance *surveillance, t_plateau plateau)
+{
+    pthread_mutex_lock(&surveillance->verrou);
+    memcpy(surveillance->plateau, plateau, sizeof(t_plateau));
+    surveillance->demande++;
+    pthread_cond_signal(&surveillance->demandeArrivee);
+    pthread_mutex_unlock(&surveillance->verrou);
+}
+
+/**
+*
+* @brief Lire le verdict de la dernière position déposée
+* @param surveillance de type t_surveillance, Entrée : surveillance
+* @param enCours de type booléen, Sortie : vrai si la vérification n'est
+*   pas terminée (le verdict est alors celui d'une position précédente)
+* @return t_verdict : dernier verdict publié
+*/
+t_verdict lire_surveillance(t_surveillance *surveillance, bool *enCours)
+{
+    t_verdict verdict;
+
+    pthread_mutex_lock(&surveillance->verrou);
+    verdict = surveillance->verdict;
+    *enCours = surveillance->traitee != surveillance->demande;
+    pthread_mutex_unlock(&surveillance->verrou);
+
+    return verdict;
+}
+
+/**
+*
+* @brief Arrêter le thread (la recherche en cours est interrompue) et
+*   libérer la surveillance
+* @param surveillance de type t_surveillance, Entrée : surveillance
+*/
+void arreter_surveillance(t_surveillance *surveillance)
+{
+    pthread_mutex_lock(&surveillance->verrou);
+    surveillance->arret = true;
+    pthread_cond_signal(&surveillance->demandeArrivee);
+    pthread_mutex_unlock(&surveillance->verrou);
+
+    pthread_join(surveillance->thread, NULL);
+    pthread_mutex_destroy(&surveillance->verrou);
+    pthread_cond_destroy(&surveillance->demandeArrivee);
+    free(surveillance);
+}
@@ -0,0 +1,60 @@
+/**
+* @file surveillance.h
+* @brief Vérification en arrière-plan que la partie peut encore être gagnée
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Un thread reçoit chaque nouvelle position de caisses et cherche si elle
+* se résout encore. Le jeu ne l'attend jamais : il dépose la position et
+* relit le verdict quand il est prêt. Une recherche devenue inutile (le
+* joueur a déjà repoussé une caisse) est interrompue.
+*
+* Le travail précédent est réutilisé : une position qui suit la dernière
+* solution trouvée est résoluble sans recherche, et les derniers verdicts
+* sont gardés (une poussée annulée retrouve le sien immédiatement). Le
+* cache des solutions (voir cache.h) est consulté avant toute recherche.
+*/
+
+#ifndef SURVEILLANCE_H
+#define SURVEILLANCE_H
+
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "sokoban.h"
+#include "solveur.h"
+#include "motifs.h"
+#include "conseil.h"
+#include "cache.h"
+
+#define NOEUDS_SURVEILLANCE 500000
+#define VERDICTS_GARDES     64
+
+// Etat partagé entre le jeu et le thread de vérification
+typedef struct {
+    pthread_t thread;
+    pthread_mutex_t verrou;
+    pthread_cond_t demandeArrivee;
+    t_motifs *motifs;
+    t_cache *cache; // a son propre verrou
+    // Protégé par verrou
+    t_plateau plateau; // dernière position déposée par le jeu
+    unsigned long demande; // numéro de cette position
+    unsigned long traitee; // numéro de la dernière position vérifiée
+    t_verdict verdict; // verdict de la position demande
+    bool arret;
+    // Propre au thread
+    unsigned long enCours; // numéro de la position en vérification
+    t_conseil plan; // dernière solution trouvée
+    t_etat etatsConnus[VERDICTS_GARDES];
+    t_verdict verdictsConnus[VERDICTS_GARDES];
+    int nbConnus;
+} t_surveillance;
+
+t_surveillance *lancer_surveillance(t_motifs *motifs, t_cache *cache);
+void surveiller_position(t_surveillance *surveillance, t_plateau plateau);
+t_verdict lire_surveillance(t_surveillance *surveillance, bool *enCours);
+void arreter_surveillance(t_surveillance *surveillance);
+
+#endif
@@ -0,0 +1,27 @@
+/**
+* @file touches.h
+* @brief Touches du jeu, partagées par le jeu dans le terminal et le
+*   serveur de parties
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*/
+
+#ifndef TOUCHES_H
+#define TOUCHES_H
+
+/* Définition des touches */
+
+#define MOVE_LEFT   'q'
+#define MOVE_RIGHT  'd'
+#define MOVE_DOWN   's'
+#define MOVE_UP     'z'
+#define GIVE_UP     'x'
+#define RESTART     'r'
+#define ZOOM_IN     '+'
+#define ZOOM_OUT    '-'
+#define UNDO        'u'
+#define PUSH_THROUGH 'p'
+#define HINT        'i'
+
+#endif
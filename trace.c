@@ -0,0 +1,144 @@
+/**
+* @file trace.c
+* @brief Trace des étapes de la boucle du jeu (format Chrome trace-event)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Le fichier est un tableau JSON d'événements complets ("ph": "X"), en
+* microsecondes ; la touche traitée est donnée dans "args".
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+/* Fonctions internes */
+
+long horloge_trace(void);
+void vider_trace(t_trace *trace);
+
+/**
+*
+* @brief Lire l'horloge monotone
+* @return entier long : temps en nanosecondes
+*/
+long horloge_trace(void)
+{
+    struct timespec temps;
+
+    clock_gettime(CLOCK_MONOTONIC, &temps);
+
+    return temps.tv_sec * 1000000000L + temps.tv_nsec;
+}
+
+/**
+*
+* @brief Écrire les événements du tampon dans le fichier et le vider
+* @param trace de type t_trace, Entrée/Sortie : trace active
+*/
+void vider_trace(t_trace *trace)
+{
+    t_evenement *evenement;
+
+    for(int i = 0 ; i < trace->nbEvenements ; i++){
+        evenement = &trace->evenements[i];
+        fprintf(trace->fichier, ",\n{\"name\": \"%s\", \"cat\": \"jeu\", "
+            "\"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, "
+            "\"tid\": 1", evenement->nom, evenement->debut / 1000.0,
+            evenement->duree / 1000.0, trace->processus);
+        if(evenement->touche == '"' || evenement->touche == '\\'){
+            fprintf(trace->fichier, ", \"args\": {\"touche\": \"\\%c\"}",
+                evenement->touche);
+        }
+        else if(isgraph((unsigned char)evenement->touche)){
+            fprintf(trace->fichier, ", \"args\": {\"touche\": \"%c\"}",
+                evenement->touche);
+        }
+        fprintf(trace->fichier, "}");
+    }
+
+    trace->nbEvenements = 0;
+}
+
+/**
+*
+* @brief Ouvrir la trace (désactivée si aucun fichier n'est donné ou s'il
+*   ne peut pas être créé)
+* @param trace de type t_trace, Sortie : trace
+* @param fichier de type chaîne de caractères, Entrée : fichier à écrire
+*   (NULL : pas de trace)
+*/
+void ouvrir_trace(t_trace *trace, char fichier[])
+{
+    trace->fichier = fichier != NULL ? fopen(fichier, "w") : NULL;
+    trace->evenements = NULL;
+    trace->nbEvenements = 0;
+    trace->origine = horloge_trace();
+    trace->processus = getpid();
+
+    if(trace->fichier != NULL){
+        trace->evenements = malloc(sizeof(t_evenement) * TRACE_TAMPON);
+        fprintf(trace->fichier, "[\n{\"name\": \"process_name\", "
+            "\"ph\": \"M\", \"pid\": %d, \"args\": {\"name\": "
+            "\"sokoban\"}}", trace->processus);
+    }
+}
+
+/**
+*
+* @brief Relever le début d'un intervalle
+* @param trace de type t_trace, Entrée : trace
+* @return entier long : instant de début (0 si la trace est désactivée)
+*/
+long debut_trace(t_trace *trace)
+{
+    return trace->fichier != NULL ? horloge_trace() - trace->origine : 0;
+}
+
+/**
+*
+* @brief Noter un intervalle qui se termine maintenant
+* @param trace de type t_trace, Entrée/Sortie : trace
+* @param nom de type chaîne de caractères, Entrée : nom de l'étape
+*   (constante)
+* @param debut de type entier long, Entrée : instant donné par debut_trace
+* @param touche de type caractère, Entrée : touche traitée ('\0' : aucune)
+*/
+void noter_trace(t_trace *trace, const char nom[], long debut, char touche)
+{
+    t_evenement *evenement;
+
+    if(trace->fichier != NULL){
+        if(trace->nbEvenements == TRACE_TAMPON){
+            vider_trace(trace);
+        }
+        evenement = &trace->evenements[trace->nbEvenements++];
+        evenement->nom = nom;
+        evenement->debut = debut;
+        evenement->duree = horloge_trace() - trace->origine - debut;
+        evenement->touche = touche;
+    }
+}
+
+/**
+*
+* @brief Écrire les derniers événements et fermer la trace
+* @param trace de type t_trace, Entrée/Sortie : trace
+*/
+void fermer_trace(t_trace *trace)
+{
+    if(trace->fichier != NULL){
+        vider_trace(trace);
+        fprintf(trace->fichier, "\n]\n");
+        fclose(trace->fichier);
+        free(trace->evenements);
+    }
+    trace->fichier = NULL;
+    trace->evenements = NULL;
+}
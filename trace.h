@@ -0,0 +1,50 @@
+/**
+* @file trace.h
+* @brief Trace des étapes de la boucle du jeu (format Chrome trace-event)
+* @author Liam CHARPENTIER
+* @version 1
+* @date 19/10/2026
+*
+* Activée en donnant un fichier dans la variable d'environnement
+* VARIABLE_TRACE, par exemple :
+*   SOKOBAN_TRACE=trace.json ./bin/jeu
+* Le fichier s'ouvre dans chrome://tracing ou https://ui.perfetto.dev.
+*
+* Chaque étape (lecture d'une touche, traitement, mise à jour du plateau,
+* test de victoire, rendu) est un intervalle noté dans un tampon en
+* mémoire ; le tampon n'est écrit que lorsqu'il est plein et à la
+* fermeture. Désactivée, la trace ne coûte qu'un test par étape.
+*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+#define VARIABLE_TRACE      "SOKOBAN_TRACE"
+#define TRACE_TAMPON        4096 // événements gardés avant écriture
+
+// Intervalle noté (le nom doit rester valide jusqu'à l'écriture)
+typedef struct {
+    const char *nom;
+    long debut; // nanosecondes depuis l'ouverture de la trace
+    long duree;
+    char touche; // touche traitée, '\0' si aucune
+} t_evenement;
+
+// Trace en cours d'écriture
+typedef struct {
+    FILE *fichier; // NULL : trace désactivée
+    t_evenement *evenements;
+    int nbEvenements;
+    long origine;
+    int processus;
+} t_trace;
+
+void ouvrir_trace(t_trace *trace, char fichier[]);
+long debut_trace(t_trace *trace);
+void noter_trace(t_trace *trace, const char nom[], long debut, char touche);
+void fermer_trace(t_trace *trace);
+
+#endif